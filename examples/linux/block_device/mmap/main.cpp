@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+#include <modm/driver/storage/block_device_mmap.hpp>
+#include <cstdio>
+
+// Set the log level
+#undef	MODM_LOG_LEVEL
+#define	MODM_LOG_LEVEL modm::log::INFO
+
+struct Filename {
+	static constexpr const char* name = "test.bin~";
+};
+
+int
+main()
+{
+	/**
+	 * This example/test writes alternating patterns into
+	 * a `modm::BdMmap` block device with a size of 16M.
+	 * The memory content is afterwards read and compared
+	 * to the pattern, once with `read()` and once directly
+	 * through the mapped memory.
+	 * Write and read operations are done on 64 byte blocks.
+	 */
+
+	// start with an empty `test.bin~` file
+	std::remove(Filename::name);
+
+	constexpr uint32_t BlockSize = 64;
+	constexpr uint32_t MemorySize = 16*1024*1024;
+
+	uint8_t bufferA[BlockSize];
+	uint8_t bufferB[BlockSize];
+	uint8_t bufferC[BlockSize];
+	std::memset(bufferA, 0xAA, BlockSize);
+	std::memset(bufferB, 0x55, BlockSize);
+
+	modm::BdMmap<Filename, MemorySize> storageDevice;
+
+	if(!storageDevice.initialize()) {
+		MODM_LOG_INFO << "Error: Unable to initialize device.";
+		exit(1);
+	}
+
+	if(!storageDevice.erase(0, MemorySize)) {
+		MODM_LOG_INFO << "Error: Unable to erase device.";
+		exit(1);
+	}
+
+	MODM_LOG_INFO << "Starting memory test!" << modm::endl;
+
+	for(uint16_t iteration = 0; iteration < 10; iteration++) {
+		uint8_t* pattern = (iteration % 2 == 0) ? bufferA : bufferB;
+
+		for(uint32_t i = 0; i < MemorySize; i += BlockSize) {
+			if(!storageDevice.write(pattern, i, BlockSize)) {
+				MODM_LOG_INFO << "Error: Unable to write data.";
+				exit(1);
+			}
+		}
+
+		for(uint32_t i = 0; i < MemorySize; i += BlockSize) {
+			if(!storageDevice.read(bufferC, i, BlockSize) or
+			   std::memcmp(pattern, bufferC, BlockSize) or
+			   std::memcmp(pattern, storageDevice.getData().data() + i, BlockSize))
+			{
+				MODM_LOG_INFO << "Error: Unexpected data at " << i << "." << modm::endl;
+				exit(1);
+			}
+		}
+		MODM_LOG_INFO << ".";
+	}
+
+	if(!storageDevice.sync() or !storageDevice.deinitialize()) {
+		MODM_LOG_INFO << "Error: Unable to write back the data.";
+		exit(1);
+	}
+
+	MODM_LOG_INFO << modm::endl << "Finished!" << modm::endl;
+
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "harness.hpp"
+#include "reporter.hpp"
+
+#include <algorithm>
+
+namespace
+{
+	// Registered benchmarks in order of registration
+	benchmark::Benchmark* first = nullptr;
+	benchmark::Benchmark* last = nullptr;
+
+	// Each sample should run for at least 20ms to hide the counter resolution
+	constexpr uint32_t sampleMilliseconds = 20;
+	// Odd number of samples to get a proper median
+	constexpr uint8_t samples = 7;
+	constexpr uint32_t maxIterations = 1'000'000'000;
+
+	benchmark::State
+	measure(benchmark::Function function, uint32_t iterations)
+	{
+		benchmark::State state(iterations);
+		function(state);
+		return state;
+	}
+
+	/// Increases the iterations until one sample runs long enough
+	uint32_t
+	scaleIterations(benchmark::Function function)
+	{
+		const uint32_t minTicks = benchmark::Counter::frequency() / 1000 * sampleMilliseconds;
+		uint32_t iterations = 1;
+		while (iterations < maxIterations)
+		{
+			const uint32_t ticks = measure(function, iterations).ticks();
+			if (ticks >= minTicks) break;
+			// estimate the required iterations with a 40% margin, but grow
+			// at most by 100x to avoid overshooting on unstable timings
+			uint64_t next = uint64_t(iterations) * 100;
+			if (ticks) next = std::min<uint64_t>(next, uint64_t(iterations) * minTicks * 14 / (ticks * 10ull));
+			iterations = std::clamp<uint64_t>(next, iterations + 1ul, maxIterations);
+		}
+		return iterations;
+	}
+}
+
+benchmark::Benchmark::Benchmark(const char* name, Function function) :
+	name(name), function(function), next(nullptr)
+{
+	if (last) last->next = this;
+	else first = this;
+	last = this;
+}
+
+int
+run_modm_benchmark()
+{
+	benchmark::reporter.printHeader();
+	for (benchmark::Benchmark* it = first; it; it = it->next)
+	{
+		// warm up caches and lazy initialization
+		measure(it->function, 1);
+		const uint32_t iterations = scaleIterations(it->function);
+
+		benchmark::State runs[samples];
+		for (benchmark::State& run : runs)
+			run = measure(it->function, iterations);
+		std::sort(runs, runs + samples, [](const auto& a, const auto& b)
+				{ return a.ticks() < b.ticks(); });
+
+		benchmark::reporter.report(it->name, iterations, runs[0].ticks(),
+				runs[samples / 2].ticks(), runs[samples - 1].ticks(),
+				runs[samples / 2]);
+	}
+	return 0;
+}
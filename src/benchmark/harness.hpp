@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	BENCHMARK_HARNESS_HPP
+#define	BENCHMARK_HARNESS_HPP
+
+#include <string_view>
+#include "counter.hpp"
+
+/// Runs all registered benchmarks and reports the results
+/// \ingroup	modm_benchmark
+int
+run_modm_benchmark();
+
+namespace benchmark
+{
+	/**
+	 * \brief	State of a running benchmark
+	 *
+	 * The benchmark function must execute the measured code inside a
+	 * range-based for loop over the state. Only the loop is measured, so
+	 * expensive setup can be done before it:
+	 *
+	 * \code
+	 * MODM_BENCHMARK(crc8)
+	 * {
+	 *     uint8_t data[64]{};
+	 *     for (auto _ : state)
+	 *         benchmark::doNotOptimize(modm::math::crc8_ccitt(data, sizeof(data)));
+	 * }
+	 * \endcode
+	 *
+	 * \ingroup	modm_benchmark
+	 */
+	class State
+	{
+	public:
+		/// \cond
+		struct [[maybe_unused]] Value {};
+
+		class Iterator
+		{
+		public:
+			Iterator(State* state, uint32_t remaining) :
+				state(state), remaining(remaining)
+			{
+			}
+
+			Value
+			operator * () const
+			{
+				return {};
+			}
+
+			void
+			operator ++ ()
+			{
+				remaining--;
+			}
+
+			bool
+			operator != (const Iterator&)
+			{
+				if (remaining) return true;
+				state->stop();
+				return false;
+			}
+
+		private:
+			State* state;
+			uint32_t remaining;
+		};
+
+		Iterator
+		begin()
+		{
+			start();
+			return {this, count};
+		}
+
+		Iterator
+		end()
+		{
+			return {this, 0};
+		}
+		/// \endcond
+
+		/// Additional named result of a run
+		struct UserCounter
+		{
+			const char* name;
+			uint32_t value;
+		};
+
+		/// Maximum number of counters per benchmark
+		static constexpr uint8_t maxCounters = 4;
+
+		/// \param	iterations	Number of times the loop is executed
+		explicit State(uint32_t iterations = 0) :
+			count(iterations), timestamp(0), elapsed(0), counterCount(0)
+		{
+		}
+
+		/// Number of loop iterations of this run
+		uint32_t
+		iterations() const
+		{
+			return count;
+		}
+
+		/// Stops the measurement, for example, to reset data inside the loop
+		void
+		pause()
+		{
+			stop();
+		}
+
+		/// Continues the measurement after `pause()`
+		void
+		resume()
+		{
+			start();
+		}
+
+		/// Measured duration in counter ticks
+		Counter::Ticks
+		ticks() const
+		{
+			return elapsed;
+		}
+
+		/**
+		 * \brief	Reports an additional value with the result of this run
+		 *
+		 * Use counters for results which are not durations, for example the
+		 * number of allocations or a latency percentile. Only the counters of
+		 * the median run are reported. Setting a counter again overwrites its
+		 * value, counters beyond `maxCounters` are ignored.
+		 *
+		 * \param	name	Name of the counter, must outlive the benchmark run
+		 */
+		void
+		setCounter(const char* name, uint32_t value)
+		{
+			for (uint8_t i = 0; i < counterCount; i++)
+			{
+				if (std::string_view(counters[i].name) == name) {
+					counters[i].value = value;
+					return;
+				}
+			}
+			if (counterCount < maxCounters) {
+				counters[counterCount++] = {name, value};
+			}
+		}
+
+		/// Counters set by the benchmark in order of their first assignment
+		const UserCounter*
+		getCounters() const
+		{
+			return counters;
+		}
+
+		uint8_t
+		getCounterCount() const
+		{
+			return counterCount;
+		}
+
+	private:
+		void
+		start()
+		{
+			timestamp = Counter::now();
+		}
+
+		void
+		stop()
+		{
+			elapsed += Counter::now() - timestamp;
+		}
+
+		uint32_t count;
+		Counter::Ticks timestamp;
+		Counter::Ticks elapsed;
+		UserCounter counters[maxCounters];
+		uint8_t counterCount;
+	};
+
+	/// \ingroup	modm_benchmark
+	using Function = void (*)(State& state);
+
+	/**
+	 * \brief	Registered benchmark
+	 *
+	 * Use the `MODM_BENCHMARK(name)` macro to define and register a
+	 * benchmark function. All benchmarks are executed in the order of
+	 * registration by `run_modm_benchmark()`.
+	 *
+	 * \ingroup	modm_benchmark
+	 */
+	class Benchmark
+	{
+	public:
+		Benchmark(const char* name, Function function);
+
+		const char* const name;
+		const Function function;
+
+	private:
+		friend int ::run_modm_benchmark();
+		Benchmark* next;
+	};
+
+	/// Prevents the compiler from optimizing away the computation of a value
+	/// \ingroup	modm_benchmark
+	template< typename T >
+	inline void
+	doNotOptimize(T&& value)
+	{
+		asm volatile ("" : : "r,m" (value) : "memory");
+	}
+
+	/// Forces the compiler to perform all pending writes to memory
+	/// \ingroup	modm_benchmark
+	inline void
+	clobberMemory()
+	{
+		asm volatile ("" : : : "memory");
+	}
+}
+
+/// \ingroup	modm_benchmark
+/// Defines and registers a benchmark function with a `benchmark::State& state`
+/// argument.
+#define	MODM_BENCHMARK(name) \
+	static void modm_benchmark_ ## name(::benchmark::State& state); \
+	static ::benchmark::Benchmark modm_benchmark_ ## name ## _registration( \
+			#name, modm_benchmark_ ## name); \
+	static void modm_benchmark_ ## name([[maybe_unused]] ::benchmark::State& state)
+
+#endif	// BENCHMARK_HARNESS_HPP
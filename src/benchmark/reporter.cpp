@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "reporter.hpp"
+#include "counter.hpp"
+
+benchmark::Reporter::Reporter(modm::IODevice& device) :
+	outputStream(device)
+{
+}
+
+void
+benchmark::Reporter::printHeader()
+{
+	outputStream << "benchmark,iterations,min_ns,median_ns,max_ns";
+	if constexpr (Counter::isCycleCounter) outputStream << ",median_cycles";
+	outputStream << modm::endl;
+}
+
+void
+benchmark::Reporter::report(const char* name, uint32_t iterations,
+							uint32_t min, uint32_t median, uint32_t max,
+							const State& state)
+{
+	outputStream << name << ',' << iterations << ',';
+	writeNanoseconds(min, iterations);
+	outputStream << ',';
+	writeNanoseconds(median, iterations);
+	outputStream << ',';
+	writeNanoseconds(max, iterations);
+	if constexpr (Counter::isCycleCounter)
+		outputStream << ',' << (median + iterations / 2) / iterations;
+	for (uint8_t i = 0; i < state.getCounterCount(); i++)
+	{
+		const State::UserCounter& counter = state.getCounters()[i];
+		outputStream << ',' << counter.name << '=' << counter.value;
+	}
+	outputStream << modm::endl;
+}
+
+void
+benchmark::Reporter::writeNanoseconds(uint32_t ticks, uint32_t iterations)
+{
+	// total nanoseconds cannot overflow, since ticks and the frequency are 32-bit
+	const uint64_t ns = (uint64_t(ticks) * 1'000'000'000ull) / Counter::frequency();
+	const uint64_t tenths = (ns * 10 + iterations / 2) / iterations;
+	outputStream << uint32_t(tenths / 10) << '.' << uint8_t(tenths % 10);
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	BENCHMARK_REPORTER_HPP
+#define	BENCHMARK_REPORTER_HPP
+
+#include <stdint.h>
+
+#include <modm/io/iostream.hpp>
+
+#include "harness.hpp"
+
+namespace benchmark
+{
+	/**
+	 * \brief	Reporter
+	 *
+	 * Prints the results as CSV, one line per benchmark. All durations are
+	 * given per loop iteration in nanoseconds with one decimal place. If the
+	 * counter is a cycle counter, the median is also given in cycles. The
+	 * counters of the benchmark are appended as `name=value` columns.
+	 *
+	 * \ingroup	modm_benchmark
+	 */
+	class Reporter
+	{
+	public:
+		/**
+		 * \brief	Constructor
+		 *
+		 * \param	device	IODevice used for printing
+		 */
+		Reporter(modm::IODevice& device);
+
+		/// Writes the CSV header line
+		void
+		printHeader();
+
+		/**
+		 * \brief	Writes the result of one benchmark
+		 *
+		 * \param	name		Name of the benchmark
+		 * \param	iterations	Loop iterations per sample
+		 * \param	min			Fastest sample in counter ticks
+		 * \param	median		Median sample in counter ticks
+		 * \param	max			Slowest sample in counter ticks
+		 * \param	state		Median run with the counters of the benchmark
+		 */
+		void
+		report(const char* name, uint32_t iterations,
+			   uint32_t min, uint32_t median, uint32_t max,
+			   const State& state);
+
+	private:
+		void
+		writeNanoseconds(uint32_t ticks, uint32_t iterations);
+
+		modm::IOStream outputStream;
+	};
+
+	extern Reporter reporter;
+}
+
+#endif	// BENCHMARK_REPORTER_HPP
@@ -13,3 +13,4 @@
 #include "atomic/flag.hpp"
 #include "atomic/container.hpp"
 #include "atomic/queue.hpp"
+#include "atomic/ring.hpp"
@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <type_traits>
 #include <modm/architecture/utils.hpp>
 
@@ -31,6 +32,15 @@ namespace modm
 		 *
 		 * A maximum size of 254 is allowed for 8-bit microcontrollers.
 		 *
+		 * Blocks of elements can be moved with `push(std::span)` and
+		 * `pop(std::span)`, or without copying by accessing the free and stored
+		 * elements in place via `getWritableRegions()` and
+		 * `getReadableRegions()`. Since the buffer wraps around, each consists
+		 * of up to two contiguous regions.
+		 *
+		 * The queue is safe to use with one producer and one consumer, for
+		 * example a thread and an interrupt.
+		 *
 		 * \todo	This implementation should work but could be improved
 		 */
 		template<typename T, std::size_t N>
@@ -42,6 +52,18 @@ namespace modm
 
 			using Size = Index;
 
+			/// Up to two contiguous regions of the buffer in queue order.
+			template<typename U>
+			struct Regions
+			{
+				std::span<U> first;
+				std::span<U> second;
+
+				/// \returns	the total number of elements in both regions.
+				std::size_t
+				size() const { return first.size() + second.size(); }
+			};
+
 		public:
 			Queue();
 
@@ -93,7 +115,51 @@ namespace modm
 			void
 			pop();
 
+			/**
+			 * Appends as many values as fit into the queue.
+			 *
+			 * \returns	the number of values appended.
+			 */
+			Size
+			push(std::span<const T> values);
+
+			/**
+			 * Removes up to `values.size()` elements from the queue and copies
+			 * them into the values.
+			 *
+			 * \returns	the number of elements removed.
+			 */
+			Size
+			pop(std::span<T> values);
+
+			/// Removes `count` elements, which must not exceed `getSize()`.
+			void
+			pop(Size count);
+
+			/**
+			 * Gives the producer direct access to the free elements. Write
+			 * elements from the start of the first region on and then make
+			 * them available with `commit()`.
+			 */
+			Regions<T>
+			getWritableRegions();
+
+			/// Appends the first `count` elements of the writable regions.
+			void
+			commit(Size count);
+
+			/**
+			 * Gives the consumer direct access to the stored elements, with
+			 * the oldest element at the start of the first region. Remove the
+			 * processed elements with `pop(count)`.
+			 */
+			Regions<const T>
+			getReadableRegions() const;
+
 		private:
+			static Index
+			advance(Index index, std::size_t count);
+
 			volatile Index head;
 			volatile Index tail;
 
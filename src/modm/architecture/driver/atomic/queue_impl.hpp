@@ -14,6 +14,8 @@
 #ifndef	MODM_ATOMIC_QUEUE_IMPL_HPP
 #define	MODM_ATOMIC_QUEUE_IMPL_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <modm/architecture/detect.hpp>
 
 template<typename T, std::size_t N>
@@ -122,4 +124,94 @@ modm::atomic::Queue<T, N>::pop()
 	this->tail = tmptail;
 }
 
+// ----------------------------------------------------------------------------
+template<typename T, std::size_t N>
+typename modm::atomic::Queue<T, N>::Index
+modm::atomic::Queue<T, N>::advance(Index index, std::size_t count)
+{
+	std::size_t next = index + count;
+	if (next >= (N+1)) {
+		next -= (N+1);
+	}
+	return next;
+}
+
+template<typename T, std::size_t N>
+typename modm::atomic::Queue<T, N>::template Regions<T>
+modm::atomic::Queue<T, N>::getWritableRegions()
+{
+	const Index tmphead = this->head;
+	const Index tmptail = this->tail;
+	std::atomic_signal_fence(std::memory_order_acquire);
+
+	// one element always stays free to distinguish a full from an empty queue
+	if (tmptail > tmphead) {
+		return {{buffer + tmphead, buffer + tmptail - 1}, {}};
+	}
+	if (tmptail == 0) {
+		return {{buffer + tmphead, buffer + N}, {}};
+	}
+	return {{buffer + tmphead, buffer + N + 1}, {buffer, buffer + tmptail - 1}};
+}
+
+template<typename T, std::size_t N>
+void
+modm::atomic::Queue<T, N>::commit(Size count)
+{
+	// the elements must be written before they are made available
+	std::atomic_signal_fence(std::memory_order_release);
+	this->head = advance(this->head, count);
+}
+
+template<typename T, std::size_t N>
+typename modm::atomic::Queue<T, N>::template Regions<const T>
+modm::atomic::Queue<T, N>::getReadableRegions() const
+{
+	const Index tmphead = this->head;
+	const Index tmptail = this->tail;
+	std::atomic_signal_fence(std::memory_order_acquire);
+
+	if (tmphead >= tmptail) {
+		return {{buffer + tmptail, buffer + tmphead}, {}};
+	}
+	return {{buffer + tmptail, buffer + N + 1}, {buffer, buffer + tmphead}};
+}
+
+template<typename T, std::size_t N>
+void
+modm::atomic::Queue<T, N>::pop(Size count)
+{
+	// the elements must be read before they are released
+	std::atomic_signal_fence(std::memory_order_release);
+	this->tail = advance(this->tail, count);
+}
+
+template<typename T, std::size_t N>
+typename modm::atomic::Queue<T, N>::Size
+modm::atomic::Queue<T, N>::push(std::span<const T> values)
+{
+	const auto regions = getWritableRegions();
+	const std::size_t first = std::min(values.size(), regions.first.size());
+	const std::size_t second = std::min(values.size() - first, regions.second.size());
+
+	std::copy_n(values.begin(), first, regions.first.begin());
+	std::copy_n(values.begin() + first, second, regions.second.begin());
+	commit(first + second);
+	return first + second;
+}
+
+template<typename T, std::size_t N>
+typename modm::atomic::Queue<T, N>::Size
+modm::atomic::Queue<T, N>::pop(std::span<T> values)
+{
+	const auto regions = getReadableRegions();
+	const std::size_t first = std::min(values.size(), regions.first.size());
+	const std::size_t second = std::min(values.size() - first, regions.second.size());
+
+	std::copy_n(regions.first.begin(), first, values.begin());
+	std::copy_n(regions.second.begin(), second, values.begin() + first);
+	pop(Size(first + second));
+	return first + second;
+}
+
 #endif	// MODM_ATOMIC_QUEUE_IMPL_HPP
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <modm/architecture/detect.hpp>
+
+namespace modm::atomic
+{
+
+/// @cond
+namespace detail
+{
+// The indices of producers and consumers are placed on separate cache lines to
+// avoid false sharing between CPUs. Microcontrollers have no data cache.
+#if defined(MODM_OS_HOSTED) and defined(MODM_CPU_AARCH64)
+inline constexpr std::size_t CacheLineSize = 128;
+#elif defined(MODM_OS_HOSTED)
+inline constexpr std::size_t CacheLineSize = 64;
+#else
+inline constexpr std::size_t CacheLineSize = alignof(std::size_t);
+#endif
+}
+/// @endcond
+
+/**
+ * Lock-free single-producer single-consumer ring buffer.
+ *
+ * The producer and the consumer may run concurrently on different cores,
+ * threads, fibers or in interrupts, as long as there is only one of each at a
+ * time. The indices are free-running and use acquire/release ordering, so that
+ * pushing and popping elements does not need a lock or a branch to wrap around.
+ *
+ * In contrast to `modm::atomic::Queue`, all `N` elements can be used.
+ *
+ * @tparam	T	trivially copyable element type
+ * @tparam	N	capacity, must be a power of two
+ *
+ * @ingroup	modm_architecture_atomic
+ */
+template<typename T, std::size_t N>
+class SpscRing
+{
+	static_assert(N > 0 and (N & (N - 1)) == 0, "The capacity must be a power of two!");
+	static_assert(std::is_trivially_copyable_v<T>, "The elements must be trivially copyable!");
+
+public:
+	static constexpr std::size_t Capacity = N;
+
+	/// Appends the value, returns `false` if the ring is full. Producer only.
+	bool
+	push(const T& value);
+
+	/// Appends as many values as fit, returns the number of values appended. Producer only.
+	std::size_t
+	push(std::span<const T> values);
+
+	/// Removes the oldest element, returns `false` if the ring is empty. Consumer only.
+	bool
+	pop(T& value);
+
+	/// Removes up to `values.size()` elements, returns the number of elements
+	/// removed. Consumer only.
+	std::size_t
+	pop(std::span<T> values);
+
+	/// @returns the number of stored elements, which may already be outdated.
+	std::size_t
+	getSize() const;
+
+	static constexpr std::size_t
+	getMaxSize() { return N; }
+
+	bool
+	isEmpty() const { return getSize() == 0; }
+
+	bool
+	isFull() const { return getSize() == N; }
+
+private:
+	static constexpr std::size_t Mask = N - 1;
+
+	// written by the producer
+	alignas(detail::CacheLineSize) std::atomic<std::size_t> head{0};
+	std::size_t tailCache{0};
+	// written by the consumer
+	alignas(detail::CacheLineSize) std::atomic<std::size_t> tail{0};
+	std::size_t headCache{0};
+
+	alignas(detail::CacheLineSize) T buffer[N];
+};
+
+/**
+ * Lock-free bounded multi-producer multi-consumer ring buffer.
+ *
+ * Every element has a sequence number, which tells producers and consumers
+ * whether the element is free to write or ready to read. The producers and the
+ * consumers each claim an element by incrementing their index with a
+ * compare-and-swap operation. Note that on ARMv6-M the atomic read-modify-write
+ * operations are implemented with a `modm::atomic::Lock`.
+ *
+ * An operation never waits on another one. If an interrupt preempts an
+ * unfinished push and then pops from the ring, the element being pushed is not
+ * ready yet and `pop()` returns `false` as if the ring was empty.
+ *
+ * @tparam	T	trivially copyable element type
+ * @tparam	N	capacity, must be a power of two
+ *
+ * @ingroup	modm_architecture_atomic
+ */
+template<typename T, std::size_t N>
+class MpmcRing
+{
+	static_assert(N > 0 and (N & (N - 1)) == 0, "The capacity must be a power of two!");
+	static_assert(std::is_trivially_copyable_v<T>, "The elements must be trivially copyable!");
+
+public:
+	static constexpr std::size_t Capacity = N;
+
+	/// Appends the value, returns `false` if the ring is full.
+	bool
+	push(const T& value);
+
+	/// Removes the oldest element, returns `false` if the ring is empty.
+	bool
+	pop(T& value);
+
+	/// @returns the number of stored elements, which may already be outdated.
+	std::size_t
+	getSize() const;
+
+	static constexpr std::size_t
+	getMaxSize() { return N; }
+
+	bool
+	isEmpty() const { return getSize() == 0; }
+
+	bool
+	isFull() const { return getSize() >= N; }
+
+private:
+	static constexpr std::size_t Mask = N - 1;
+
+	struct Cell
+	{
+		// Sequence number relative to the index of the cell, so that all cells
+		// are initialized with zero and the ring needs no constructor code.
+		std::atomic<std::size_t> sequence{0};
+		T value;
+	};
+
+	alignas(detail::CacheLineSize) std::atomic<std::size_t> head{0};
+	alignas(detail::CacheLineSize) std::atomic<std::size_t> tail{0};
+	alignas(detail::CacheLineSize) Cell cells[N];
+};
+
+} // namespace modm::atomic
+
+#include "ring_impl.hpp"
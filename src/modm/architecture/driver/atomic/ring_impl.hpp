@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+
+// ----------------------------------------------------------------------------
+template<typename T, std::size_t N>
+bool
+modm::atomic::SpscRing<T, N>::push(const T& value)
+{
+	const std::size_t h = head.load(std::memory_order_relaxed);
+	if (h - tailCache == N)
+	{
+		// only load the index of the consumer if the ring appears to be full
+		tailCache = tail.load(std::memory_order_acquire);
+		if (h - tailCache == N) return false;
+	}
+	buffer[h & Mask] = value;
+	head.store(h + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename T, std::size_t N>
+std::size_t
+modm::atomic::SpscRing<T, N>::push(std::span<const T> values)
+{
+	const std::size_t h = head.load(std::memory_order_relaxed);
+	tailCache = tail.load(std::memory_order_acquire);
+	const std::size_t count = std::min(values.size(), N - (h - tailCache));
+
+	// copy up to the end of the buffer and then from its start
+	const std::size_t first = std::min(count, N - (h & Mask));
+	std::copy_n(values.begin(), first, buffer + (h & Mask));
+	std::copy_n(values.begin() + first, count - first, buffer);
+
+	head.store(h + count, std::memory_order_release);
+	return count;
+}
+
+template<typename T, std::size_t N>
+bool
+modm::atomic::SpscRing<T, N>::pop(T& value)
+{
+	const std::size_t t = tail.load(std::memory_order_relaxed);
+	if (t == headCache)
+	{
+		// only load the index of the producer if the ring appears to be empty
+		headCache = head.load(std::memory_order_acquire);
+		if (t == headCache) return false;
+	}
+	value = buffer[t & Mask];
+	tail.store(t + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename T, std::size_t N>
+std::size_t
+modm::atomic::SpscRing<T, N>::pop(std::span<T> values)
+{
+	const std::size_t t = tail.load(std::memory_order_relaxed);
+	headCache = head.load(std::memory_order_acquire);
+	const std::size_t count = std::min(values.size(), headCache - t);
+
+	const std::size_t first = std::min(count, N - (t & Mask));
+	std::copy_n(buffer + (t & Mask), first, values.begin());
+	std::copy_n(buffer, count - first, values.begin() + first);
+
+	tail.store(t + count, std::memory_order_release);
+	return count;
+}
+
+template<typename T, std::size_t N>
+std::size_t
+modm::atomic::SpscRing<T, N>::getSize() const
+{
+	const std::size_t t = tail.load(std::memory_order_acquire);
+	return head.load(std::memory_order_acquire) - t;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, std::size_t N>
+bool
+modm::atomic::MpmcRing<T, N>::push(const T& value)
+{
+	std::size_t h = head.load(std::memory_order_relaxed);
+	Cell *cell;
+	while(true)
+	{
+		cell = &cells[h & Mask];
+		// the cell is free when its sequence equals the index
+		const std::size_t sequence = cell->sequence.load(std::memory_order_acquire) + (h & Mask);
+		const std::ptrdiff_t difference = std::ptrdiff_t(sequence - h);
+		if (difference == 0)
+		{
+			if (head.compare_exchange_weak(h, h + 1, std::memory_order_relaxed)) break;
+		}
+		// the cell still contains an element from the previous round
+		else if (difference < 0) return false;
+		// another producer claimed the cell
+		else h = head.load(std::memory_order_relaxed);
+	}
+	cell->value = value;
+	cell->sequence.store(h + 1 - (h & Mask), std::memory_order_release);
+	return true;
+}
+
+template<typename T, std::size_t N>
+bool
+modm::atomic::MpmcRing<T, N>::pop(T& value)
+{
+	std::size_t t = tail.load(std::memory_order_relaxed);
+	Cell *cell;
+	while(true)
+	{
+		cell = &cells[t & Mask];
+		// the cell is ready when its sequence is one ahead of the index
+		const std::size_t sequence = cell->sequence.load(std::memory_order_acquire) + (t & Mask);
+		const std::ptrdiff_t difference = std::ptrdiff_t(sequence - (t + 1));
+		if (difference == 0)
+		{
+			if (tail.compare_exchange_weak(t, t + 1, std::memory_order_relaxed)) break;
+		}
+		// the cell has not been written yet
+		else if (difference < 0) return false;
+		// another consumer claimed the cell
+		else t = tail.load(std::memory_order_relaxed);
+	}
+	value = cell->value;
+	// the cell is free again for the index of the next round
+	cell->sequence.store(t + N - (t & Mask), std::memory_order_release);
+	return true;
+}
+
+template<typename T, std::size_t N>
+std::size_t
+modm::atomic::MpmcRing<T, N>::getSize() const
+{
+	const std::size_t t = tail.load(std::memory_order_acquire);
+	const std::size_t h = head.load(std::memory_order_acquire);
+	// a consumer may have claimed an element before it was claimed by a producer
+	return std::ptrdiff_t(h - t) > 0 ? h - t : 0;
+}
@@ -53,6 +53,15 @@ yield();
 modm::fiber::id
 get_id();
 
+/// @cond
+namespace detail
+{
+// Suspends the current fiber until the duration has elapsed on the given clock.
+void sleep(modm::chrono::milli_clock::duration sleep_duration);
+void sleep(modm::chrono::micro_clock::duration sleep_duration);
+}
+/// @endcond
+
 /// Yields the current fiber until `bool condition()` returns true.
 /// @warning If `bool condition()` is true on first call, no yield is performed!
 template< class Function >
@@ -134,7 +143,10 @@ poll_until(std::chrono::time_point<Clock, Duration> sleep_time, Function &&condi
 }
 
 /**
- * Yields the current fiber until the time duration has elapsed.
+ * Suspends the current fiber until the time duration has elapsed.
+ *
+ * The scheduler parks the fiber in a sleep queue, so that it is not switched
+ * to until the deadline has passed. A zero duration yields exactly once.
  *
  * @note For nanosecond delays, use `modm::delay(ns)`.
  * @note Due to the overhead of `yield()` and the scheduling other fibers, the
@@ -145,11 +157,18 @@ template< class Rep, class Period >
 void
 sleep_for(std::chrono::duration<Rep, Period> sleep_duration)
 {
-	(void) poll_for(sleep_duration, []{ return false; });
+	// Only choose the microsecond clock if necessary
+	using Clock = std::conditional_t<
+		std::is_convertible_v<std::chrono::duration<Rep, Period>,
+							  std::chrono::duration<Rep, std::milli>>,
+		modm::chrono::milli_clock, modm::chrono::micro_clock>;
+
+	// Ensure the sleep duration is rounded up to the next full clock tick
+	detail::sleep(std::chrono::ceil<typename Clock::duration>(sleep_duration));
 }
 
 /**
- * Yields the current fiber until the sleep time has been reached.
+ * Suspends the current fiber until the sleep time has been reached.
  *
  * @note Due to the overhead of `yield()` and the scheduling other fibers, the
  *       sleep duration may be longer without any guarantee of an upper limit.
@@ -159,7 +178,17 @@ template< class Clock, class Duration >
 void
 sleep_until(std::chrono::time_point<Clock, Duration> sleep_time)
 {
-	(void) poll_until(sleep_time, []{ return false; });
+	const auto now = Clock::now();
+	// The clocks are unsigned, so a deadline in the past must not be subtracted
+	if (sleep_time <= now) return yield();
+	const auto sleep_duration = sleep_time - now;
+
+	// Sleep on the clock of the time point if the scheduler supports it
+	if constexpr (std::is_same_v<Clock, modm::chrono::milli_clock> or
+				  std::is_same_v<Clock, modm::chrono::micro_clock>)
+		detail::sleep(std::chrono::ceil<typename Clock::duration>(sleep_duration));
+	else
+		sleep_for(sleep_duration);
 }
 
 /// @}
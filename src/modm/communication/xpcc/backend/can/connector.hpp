@@ -17,8 +17,11 @@
 #ifndef	XPCC_CAN_CONNECTOR_HPP
 #define	XPCC_CAN_CONNECTOR_HPP
 
-#include <modm/container/linked_list.hpp>
+#include <modm/container/intrusive_doubly_linked_list.hpp>
+#include <modm/container/intrusive_linked_list.hpp>
+#include <modm/container/static_flat_map.hpp>
 #include "../backend_interface.hpp"
+#include "../../entry_pool.hpp"
 
 // Filter
 #define XPCC_CAN_PACKET_DESTINATION(x)		(static_cast<uint32_t>(x) << 16)
@@ -116,6 +119,12 @@ namespace xpcc
 	 *
 	 * Every event is send with the destination identifier \c 0x00.
 	 *
+	 * Fragmented messages are reassembled in a table indexed by the
+	 * identifier and message counter, which holds up to
+	 * \c maxPendingMessages partially received messages. If the table is
+	 * full, the oldest incomplete message is dropped. Every call to update()
+	 * sends as many waiting frames as the driver accepts.
+	 *
 	 * \todo timeout
 	 *
 	 * \ingroup	modm_communication_xpcc_backend
@@ -124,13 +133,16 @@ namespace xpcc
 	class CanConnector : protected CanConnectorBase, public BackendInterface
 	{
 	public:
+		/// Maximum number of fragmented messages received at the same time
+		static constexpr std::size_t maxPendingMessages = 8;
+
 		CanConnector(Driver *driver);
 
 		virtual
 		~CanConnector();
 
 		virtual void
-		sendPacket(const Header &header, modm::SmartPointer payload);
+		sendPacket(const Header &header, modm::SharedBuffer payload);
 
 
 		virtual bool
@@ -139,7 +151,7 @@ namespace xpcc
 		virtual const Header&
 		getPacketHeader() const;
 
-		virtual const modm::SmartPointer
+		virtual const modm::SharedBuffer&
 		getPacketPayload() const;
 
 		virtual void
@@ -167,6 +179,10 @@ namespace xpcc
 		void
 		sendWaitingMessages();
 
+		/// Try to send the next frame of the first message of the send list
+		bool
+		sendNextFrame();
+
 		bool
 		retrieveMessage();
 
@@ -175,9 +191,9 @@ namespace xpcc
 		{
 		public:
 			SendListItem(const uint32_t & inIdentifier,
-					const modm::SmartPointer& inPayload) :
+					modm::SharedBuffer&& inPayload) :
 				identifier(inIdentifier),
-				payload(inPayload),
+				payload(std::move(inPayload)),
 				fragmentIndex(0)
 			{
 			}
@@ -190,10 +206,12 @@ namespace xpcc
 			}
 
 			uint32_t identifier;
-			modm::SmartPointer payload;
+			modm::SharedBuffer payload;
 
 			uint8_t fragmentIndex;
 
+			modm::IntrusiveLinkedListHook<SendListItem> hook;
+
 		private:
 			SendListItem&
 			operator = (const SendListItem& other);
@@ -218,22 +236,48 @@ namespace xpcc
 			}
 
 			Header header;
-			modm::SmartPointer payload;
+			modm::SharedBuffer payload;
 
 			uint8_t receivedFragments;
 			const uint8_t counter;
 
+			modm::IntrusiveDoublyLinkedListHook<ReceiveListItem> hook;
+
 		private:
 			ReceiveListItem&
 			operator = (const ReceiveListItem& other);
 		};
 
-		typedef modm::LinkedList< SendListItem > SendList;
-		typedef modm::LinkedList< ReceiveListItem > ReceiveList;
+		typedef modm::IntrusiveLinkedList< SendListItem > SendList;
+		typedef modm::IntrusiveDoublyLinkedList< ReceiveListItem > ReceiveList;
+
+		/// Key of a fragmented message in the reassembly table. The
+		/// message counter replaces the two constant flags of the 29-bit
+		/// identifier, so that the key fits into 31 bits.
+		static inline uint32_t
+		getPendingKey(const Header& header, uint8_t counter)
+		{
+			const uint32_t identifier = convertToIdentifier(header, false);
+			return (uint32_t(counter & 0xf0) << 23) |
+					((identifier >> 2) & 0x07000000) |
+					(identifier & 0x00ffffff);
+		}
+
+		/// Removes the first message from the list and releases its memory.
+		void
+		removeFront(SendList& list);
+
+		void
+		removeFront(ReceiveList& list);
 
 	protected:
+		xpcc::EntryPool< SendListItem > sendPool;
+		xpcc::EntryPool< ReceiveListItem > receivePool;
+
 		SendList sendList;
+		/// Incomplete fragmented messages, the oldest first
 		ReceiveList pendingMessages;
+		modm::static_flat_map<uint32_t, ReceiveListItem*, maxPendingMessages> pendingIndex;
 		ReceiveList receivedMessages;
 
 		Driver *canDriver;
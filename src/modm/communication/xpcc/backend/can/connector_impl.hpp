@@ -30,6 +30,15 @@ xpcc::CanConnector<Driver>::CanConnector(Driver *driver) :
 template<typename Driver>
 xpcc::CanConnector<Driver>::~CanConnector()
 {
+	while (!this->sendList.isEmpty()) {
+		this->removeFront(this->sendList);
+	}
+	while (!this->pendingMessages.isEmpty()) {
+		this->removeFront(this->pendingMessages);
+	}
+	while (!this->receivedMessages.isEmpty()) {
+		this->removeFront(this->receivedMessages);
+	}
 }
 
 // ----------------------------------------------------------------------------
@@ -48,7 +57,7 @@ xpcc::CanConnector<Driver>::getPacketHeader() const
 }
 
 template<typename Driver>
-const modm::SmartPointer
+const modm::SharedBuffer&
 xpcc::CanConnector<Driver>::getPacketPayload() const
 {
 	return this->receivedMessages.getFront().payload;
@@ -57,15 +66,17 @@ xpcc::CanConnector<Driver>::getPacketPayload() const
 // ----------------------------------------------------------------------------
 template<typename Driver>
 void
-xpcc::CanConnector<Driver>::sendPacket(const Header &header, modm::SmartPointer payload)
+xpcc::CanConnector<Driver>::sendPacket(const Header &header, modm::SharedBuffer payload)
 {
 	bool successful = false;
 	bool fragmented = (payload.getSize() > 8);
 
 	uint32_t identifier = convertToIdentifier(header, fragmented);
-	if (!fragmented && this->canDriver->isReadyToSend())
+	if (!fragmented && this->sendList.isEmpty() &&
+			this->canDriver->isReadyToSend())
 	{
-		// try to send the message directly
+		// try to send the message directly, unless that would overtake
+		// waiting messages
 		successful = this->sendMessage(identifier,
 				payload.getPointer(), payload.getSize());
 	}
@@ -73,7 +84,7 @@ xpcc::CanConnector<Driver>::sendPacket(const Header &header, modm::SmartPointer
 	if (!successful)
 	{
 		// append the message to the list of waiting messages
-		this->sendList.append(SendListItem(identifier, payload));
+		this->sendList.append(*this->sendPool.create(identifier, std::move(payload)));
 	}
 }
 
@@ -82,7 +93,7 @@ template<typename Driver>
 void
 xpcc::CanConnector<Driver>::dropPacket()
 {
-	this->receivedMessages.removeFront();
+	this->removeFront(this->receivedMessages);
 }
 
 // ----------------------------------------------------------------------------
@@ -124,11 +135,24 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 	else if (canDriver->getBusState() != Driver::BusState::Connected) {
 		// No connection to the CAN bus, drop all messages which should be send
 		while (!sendList.isEmpty()) {
-			sendList.removeFront();
+			this->removeFront(sendList);
 		}
 		return;
 	}
 
+	// fill all free transmit buffers of the driver
+	while (!this->sendList.isEmpty() && this->canDriver->isReadyToSend())
+	{
+		if (!this->sendNextFrame()) {
+			break;
+		}
+	}
+}
+
+template<typename Driver>
+bool
+xpcc::CanConnector<Driver>::sendNextFrame()
+{
 	SendListItem& message = this->sendList.getFront();
 
 	uint8_t messageSize = message.payload.getSize();
@@ -153,26 +177,46 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 
 		memcpy(data + 2, message.payload.getPointer() + offset, fragmentSize);
 
-		if (sendMessage(message.identifier, data, fragmentSize + 2))
+		if (!sendMessage(message.identifier, data, fragmentSize + 2)) {
+			return false;
+		}
+
+		message.fragmentIndex++;
+		if (sendFinished)
 		{
-			message.fragmentIndex++;
-			if (sendFinished)
-			{
-				// message was the last fragment
-				// => remove it from the list
-				this->sendList.removeFront();
-				this->messageCounter += 0x10;
-			}
+			// message was the last fragment
+			// => remove it from the list
+			this->removeFront(this->sendList);
+			this->messageCounter += 0x10;
 		}
 	}
 	else
 	{
-		if (this->sendMessage(message.identifier, message.payload.getPointer(),
-				messageSize))
-		{
-			this->sendList.removeFront();
+		if (!this->sendMessage(message.identifier, message.payload.getPointer(),
+				messageSize)) {
+			return false;
 		}
+		this->removeFront(this->sendList);
 	}
+	return true;
+}
+
+template<typename Driver>
+void
+xpcc::CanConnector<Driver>::removeFront(SendList& list)
+{
+	SendListItem& item = list.getFront();
+	list.removeFront();
+	this->sendPool.destroy(&item);
+}
+
+template<typename Driver>
+void
+xpcc::CanConnector<Driver>::removeFront(ReceiveList& list)
+{
+	ReceiveListItem& item = list.getFront();
+	list.removeFront();
+	this->receivePool.destroy(&item);
 }
 
 template<typename Driver>
@@ -187,7 +231,7 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 
 		if (!isFragment)
 		{
-			this->receivedMessages.append(ReceiveListItem(message.length, header));
+			this->receivedMessages.append(*this->receivePool.create(message.length, header));
 			std::memcpy(this->receivedMessages.getBack().payload.getPointer(),
 					message.data,
 					message.length);
@@ -231,24 +275,34 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 				return false;
 			}
 
-			// Check if other parts of this message are already in the
-			// list of receiving messages.
-			typename ReceiveList::iterator packet = this->pendingMessages.begin();
-			for ( ; packet != this->pendingMessages.end(); ++packet)
+			// Check if other parts of this message were already received
+			const uint32_t key = getPendingKey(header, counter);
+			auto entry = this->pendingIndex.find(key);
+			if (entry != this->pendingIndex.end() &&
+					entry->second->payload.getSize() != messageSize)
 			{
-				if (packet->header == header &&
-					packet->counter == counter)
+				// same identifier and counter, but a different message
+				ReceiveListItem& stale = *entry->second;
+				this->pendingIndex.erase(entry);
+				this->pendingMessages.remove(stale);
+				this->receivePool.destroy(&stale);
+				entry = this->pendingIndex.end();
+			}
+			if (entry == this->pendingIndex.end())
+			{
+				// message not found => first part of this message
+				if (this->pendingIndex.isFull())
 				{
-					break;
+					// drop the oldest incomplete message
+					ReceiveListItem& oldest = this->pendingMessages.getFront();
+					this->pendingIndex.erase(getPendingKey(oldest.header, oldest.counter));
+					this->removeFront(this->pendingMessages);
 				}
+				ReceiveListItem* item = this->receivePool.create(messageSize, header, counter);
+				this->pendingMessages.append(*item);
+				entry = this->pendingIndex.try_emplace(key, item).first;
 			}
-
-			if (packet == this->pendingMessages.end()) {
-				// message not found => first part of this message,
-				// prepend it to the list
-				this->pendingMessages.prepend(ReceiveListItem(messageSize, header, counter));
-				packet = this->pendingMessages.begin();
-			}
+			ReceiveListItem* packet = entry->second;
 
 			// create a marker for the currently received fragment and
 			// test if the fragment was already received
@@ -269,8 +323,10 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 			// for more messages
 			if (modm::bitCount(packet->receivedFragments) == numberOfFragments)
 			{
+				// move the message to the list of received messages
+				this->pendingIndex.erase(entry);
+				this->pendingMessages.remove(*packet);
 				this->receivedMessages.append(*packet);
-				this->pendingMessages.remove(packet);
 			}
 		}
 
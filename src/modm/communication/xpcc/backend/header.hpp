@@ -17,7 +17,7 @@
 
 #include <stdint.h>
 
-#include <modm/container/smart_pointer.hpp>
+#include <modm/container/shared_buffer.hpp>
 
 namespace xpcc
 {
@@ -31,8 +31,7 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier)
 			this->ownIdentifier,
 			actionIdentifier);
 
-	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload);
+	this->dispatcher.addMessage(header, modm::SharedBuffer());
 }
 
 void
@@ -43,8 +42,7 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier, Respo
 			this->ownIdentifier,
 			actionIdentifier);
 
-	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload, responseCallback);
+	this->dispatcher.addMessage(header, modm::SharedBuffer(), responseCallback);
 }
 
 // ----------------------------------------------------------------------------
@@ -56,8 +54,7 @@ xpcc::Communicator::publishEvent(uint8_t eventIdentifier)
 			this->ownIdentifier,
 			eventIdentifier);
 
-	modm::SmartPointer payload;
-	this->dispatcher.addMessage(header, payload);
+	this->dispatcher.addMessage(header, modm::SharedBuffer());
 }
 
 // ----------------------------------------------------------------------------
@@ -69,8 +66,7 @@ xpcc::Communicator::sendResponse(const ResponseHandle& handle)
 			this->ownIdentifier,
 			handle.packetIdentifier);
 
-	modm::SmartPointer payload;
-	this->dispatcher.addResponse(header, payload);
+	this->dispatcher.addResponse(header, modm::SharedBuffer());
 }
 
 void
@@ -81,6 +77,5 @@ xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle)
 			this->ownIdentifier,
 			handle.packetIdentifier);
 
-	modm::SmartPointer payload;
-	this->dispatcher.addResponse(header, payload);
+	this->dispatcher.addResponse(header, modm::SharedBuffer());
 }
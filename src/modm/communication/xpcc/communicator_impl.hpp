@@ -29,9 +29,9 @@ xpcc::Communicator::callAction(uint8_t receiver,
 			this->ownIdentifier,
 			actionIdentifier);
 
-	modm::SmartPointer payload(&data);
+	modm::SharedBuffer payload(&data);
 
-	this->dispatcher.addMessage(header, payload);
+	this->dispatcher.addMessage(header, std::move(payload));
 }
 
 // ----------------------------------------------------------------------------
@@ -45,9 +45,9 @@ xpcc::Communicator::callAction(uint8_t receiver, uint8_t actionIdentifier,
 			this->ownIdentifier,
 			actionIdentifier);
 
-	modm::SmartPointer payload(&data);
+	modm::SharedBuffer payload(&data);
 
-	this->dispatcher.addMessage(header, payload, responseCallback);
+	this->dispatcher.addMessage(header, std::move(payload), responseCallback);
 }
 
 // ----------------------------------------------------------------------------
@@ -60,8 +60,8 @@ xpcc::Communicator::publishEvent(uint8_t eventIdentifier, const T& data)
 			this->ownIdentifier,
 			eventIdentifier);
 
-	modm::SmartPointer payload(&data);	// no metadata is sent with Events
-	this->dispatcher.addMessage(header, payload);
+	modm::SharedBuffer payload(&data);	// no metadata is sent with Events
+	this->dispatcher.addMessage(header, std::move(payload));
 }
 
 // ----------------------------------------------------------------------------
@@ -74,8 +74,8 @@ xpcc::Communicator::sendResponse(const ResponseHandle& handle, const T& data)
 			this->ownIdentifier,
 			handle.packetIdentifier);
 
-	modm::SmartPointer payload(&data);
-	this->dispatcher.addResponse(header, payload);
+	modm::SharedBuffer payload(&data);
+	this->dispatcher.addResponse(header, std::move(payload));
 }
 
 template<typename T>
@@ -87,6 +87,6 @@ xpcc::Communicator::sendNegativeResponse(const ResponseHandle& handle, const T&
 			this->ownIdentifier,
 			handle.packetIdentifier);
 
-	modm::SmartPointer payload(&data);
-	this->dispatcher.addResponse(header, payload);
+	modm::SharedBuffer payload(&data);
+	this->dispatcher.addResponse(header, std::move(payload));
 }
@@ -16,6 +16,8 @@
 
 #include "dispatcher.hpp"
 
+#include <bit>
+
 #include <modm/debug/logger/logger.hpp>
 // set the Loglevel
 #undef  MODM_LOG_LEVEL
@@ -26,6 +28,18 @@ xpcc::Dispatcher::Dispatcher(BackendInterface *backend_, Postman* postman_) :
 {
 }
 
+xpcc::Dispatcher::~Dispatcher()
+{
+	for (Entry::State state : {Entry::State::TransmissionPending,
+			Entry::State::WaitForACK, Entry::State::WaitForResponse})
+	{
+		EntryList& list = this->getList(state);
+		while (!list.isEmpty()) {
+			this->removeEntry(list.getFront());
+		}
+	}
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::Dispatcher::update()
@@ -50,7 +64,7 @@ xpcc::Dispatcher::updateOnceRx()
 	if (this->backend->isPacketAvailable())
 	{
 		const Header& header = this->backend->getPacketHeader();
-		const modm::SmartPointer& payload = this->backend->getPacketPayload();
+		const modm::SharedBuffer& payload = this->backend->getPacketPayload();
 
 		if (header.type == Header::Type::REQUEST && !header.isAcknowledge)
 		{
@@ -70,7 +84,7 @@ xpcc::Dispatcher::updateOnceRx()
 
 void
 xpcc::Dispatcher::handleActionCall(const Header& header,
-		const modm::SmartPointer& payload)
+		const modm::SharedBuffer& payload)
 {
 	xpcc::Postman::DeliverInfo result = postman->deliverPacket(header, payload);
 
@@ -107,53 +121,49 @@ xpcc::Dispatcher::Entry::headerFits(const Header& inHeader) const
 
 bool
 xpcc::Dispatcher::handlePacket(const Header& header,
-		const modm::SmartPointer& payload)
+		const modm::SharedBuffer& payload)
 {
 	bool ack = false;
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	for (Entry& entry : this->getBucket(header.source, header.destination,
+			header.packetIdentifier))
 	{
-		if (entry->type == Entry::Type::Default)
+		if (!entry.headerFits(header)) {
+			continue;
+		}
+
+		if (entry.type == Entry::Type::Default)
 		{
 			// waiting for ack, no response can be handled
-			if (entry->headerFits(header))
-			{
-				entry = this->entries.remove(entry);
-				return ack;
-			}
+			this->removeEntry(entry);
 		}
-		else if (entry->type == Entry::Type::Callback)
+		else if (entry.type == Entry::Type::Callback)
 		{
-			if (entry->headerFits(header))
+			// entry actual has to be marked acknowledged if acknowleded
+			// request
+			if (header.type == Header::Type::REQUEST)
 			{
-				// entry actual has to be marked acknowledged if acknowleded
-				// request
-				if (header.type == Header::Type::REQUEST)
+				// Must be an acknowledge otherwise there is an error in
+				// communication, cause no requests can be handled here
+				if (header.isAcknowledge)
 				{
-					// Must be an acknowledge otherwise there is an error in
-					// communication, cause no requests can be handled here
-					if (header.isAcknowledge)
-					{
-						// make sure no requests passed here
-						entry->state = Entry::State::WaitForResponse;
-					}
+					// make sure no requests passed here
+					this->setState(entry, Entry::State::WaitForResponse);
 				}
-				else
-				{
-					// response or negative response
-					if (!header.isAcknowledge) {
-						entry->callbackResponse(header, payload);
-						ack = true;
-					} else {
-						// cannot happen, since responses with callbacks are
-						// not possible
-					}
-					entry = this->entries.remove(entry);
+			}
+			else
+			{
+				// response or negative response
+				if (!header.isAcknowledge) {
+					entry.callbackResponse(header, payload);
+					ack = true;
+				} else {
+					// cannot happen, since responses with callbacks are
+					// not possible
 				}
-				return ack;
+				this->removeEntry(entry);
 			}
 		}
-		++entry;
+		return ack;
 	}
 	return ack;
 }
@@ -166,21 +176,23 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 	// communication externally
 	backend->sendPacket(entry->header, entry->payload);
 
-	if (entry->header.type == Header::Type::REQUEST)
+	Entry& message = *entry;
+	if (message.header.type == Header::Type::REQUEST)
 	{
-		postman->deliverPacket(entry->header, entry->payload);
+		postman->deliverPacket(message.header, message.payload);
 		// TODO handle postman errors?
 
-		if (entry->type == Entry::Type::Callback)
+		++entry;
+		if (message.type == Entry::Type::Callback)
 		{
 			// TODO timer for RESPONSES not handeled yet
-			entry->state = Entry::State::WaitForResponse;
-			entry->time.restart(responseTimeout);
-			return entry;
+			message.time.restart(responseTimeout);
+			this->setState(message, Entry::State::WaitForResponse);
 		}
 		else {
-			return this->entries.remove(entry);
+			this->removeEntry(message);
 		}
+		return entry;
 	}
 	else
 	{
@@ -190,98 +202,99 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 		// as the RESPONSE
 		//
 		// responses are inserted at front, requests at end,
-		// thus we only need to search after the RESPONSE
+		// thus all requests are behind the RESPONSE
 
-		auto req = entry;
-		for (++req; req != this->entries.end(); ++req)
+		for (Entry& req : this->getBucket(message.header.source,
+				message.header.destination, message.header.packetIdentifier))
 		{
-			if (req->header.type == Header::Type::REQUEST and
+			if (req.header.type == Header::Type::REQUEST and
 			    // must be State::WaitForResponse
-			    req->state != Entry::State::TransmissionPending and
-			    req->headerFits(entry->header))
+			    req.state != Entry::State::TransmissionPending and
+			    req.headerFits(message.header))
 			{
-				if (req->type == Entry::Type::Callback)
+				if (req.type == Entry::Type::Callback)
 				{
-					req->callbackResponse(entry->header, entry->payload);
+					req.callbackResponse(message.header, message.payload);
 				}
-				this->entries.remove(req);
+				this->removeEntry(req);
 				break;
 			}
 		}
 
-		return this->entries.remove(entry);
+		++entry;
+		this->removeEntry(message);
+		return entry;
 	}
-
-	return entry;
 }
 
 void
 xpcc::Dispatcher::handleWaitingMessages()
 {
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	this->handleAcknowledgeTimeouts();
+
+	auto entry = this->pending.begin();
+	while(entry != this->pending.end())
 	{
-		if (entry->state == Entry::State::TransmissionPending)
+		if (entry->header.destination == 0)
 		{
-			if (entry->header.destination == 0)
-			{
-				// event
-				postman->deliverPacket(entry->header, entry->payload);
-				backend->sendPacket(entry->header, entry->payload);
+			// event
+			Entry& event = *entry;
+			postman->deliverPacket(event.header, event.payload);
+			backend->sendPacket(event.header, event.payload);
 
-				entry = this->entries.remove(entry);
-				continue;
+			++entry;
+			this->removeEntry(event);
+		}
+		else
+		{
+			// action or response
+			if (postman->isComponentAvailable(entry->header.destination))
+			{
+				entry = sendMessageToInnerComponent(entry);
 			}
 			else
 			{
-				// action or response
-				if (postman->isComponentAvailable(entry->header.destination))
-				{
-					entry = sendMessageToInnerComponent(entry);
-					continue;
-				}
-				else
-				{
-					// destination not on board, message has to be sent
-					// out to the backend
-					backend->sendPacket(entry->header, entry->payload);
-
-					entry->state = Entry::State::WaitForACK;
-					entry->time.restart(acknowledgeTimeout);
+				// destination not on board, message has to be sent
+				// out to the backend
+				Entry& message = *entry;
+				backend->sendPacket(message.header, message.payload);
 
-					++entry;
-				}
+				++entry;
+				message.time.restart(acknowledgeTimeout);
+				this->setState(message, Entry::State::WaitForACK);
 			}
 		}
-		else if (entry->state == Entry::State::WaitForACK)
-		{
-			if (entry->time.isExpired())
-			{
-				if (entry->tries >= 2)
-				{
-                    Header header = entry->header;
-                    header.type = Header::Type::TIMEOUT;
-                    entry->callbackResponse(header, entry->payload);
-					entry = this->entries.remove(entry);
-					continue;
-				}
-				else
-				{
-					backend->sendPacket(entry->header, entry->payload);
-
-					entry->tries++;
-					entry->time.restart(acknowledgeTimeout);
-				}
-			}
+	}
+	// WAIT_FOR_RESPONSE
+	// Responses stay in the queue for ever if no response ever
+	// comes. This may have to be changed.
+}
 
-			++entry;
+void
+xpcc::Dispatcher::handleAcknowledgeTimeouts()
+{
+	// All entries use the same timeout, so the list is ordered by deadline
+	// and only the expired entries at the front need to be checked.
+	while (!this->waitingForAck.isEmpty() and
+			this->waitingForAck.getFront().time.isExpired())
+	{
+		Entry& entry = this->waitingForAck.getFront();
+		if (entry.tries >= 2)
+		{
+			Header header = entry.header;
+			header.type = Header::Type::TIMEOUT;
+			entry.callbackResponse(header, entry.payload);
+			this->removeEntry(entry);
 		}
 		else
 		{
-			// WAIT_FOR_RESPONSE
-			// Responses stay in the queue for ever if no response ever
-			// comes. This may have to be changed.
-			++entry;
+			backend->sendPacket(entry.header, entry.payload);
+
+			entry.tries++;
+			entry.time.restart(acknowledgeTimeout);
+
+			this->waitingForAck.removeFront();
+			this->waitingForAck.append(entry);
 		}
 	}
 }
@@ -289,21 +302,21 @@ xpcc::Dispatcher::handleWaitingMessages()
 // ----------------------------------------------------------------------------
 void
 xpcc::Dispatcher::addMessage(const Header& header,
-		modm::SmartPointer& smartPayload)
+		modm::SharedBuffer payload)
 {
-	this->entries.append(Entry(header, smartPayload));
+	this->addEntry(*this->pool.create(header, std::move(payload)), false);
 }
 
 void
 xpcc::Dispatcher::addMessage(const Header& header,
-		modm::SmartPointer& smartPayload, ResponseCallback& responseCallback)
+		modm::SharedBuffer payload, ResponseCallback& responseCallback)
 {
-	this->entries.append(Entry(header, smartPayload, responseCallback));
+	this->addEntry(*this->pool.create(header, std::move(payload), responseCallback), false);
 }
 
 void
 xpcc::Dispatcher::addResponse(const Header& header,
-		modm::SmartPointer& smartPayload)
+		modm::SharedBuffer payload)
 {
 	// it makes response more important, than requests
 	// it prevents intern loops. Since it is possible to give a response while
@@ -314,5 +327,63 @@ xpcc::Dispatcher::addResponse(const Header& header,
 	// but now responses are handled in reverse order that's not good
 	// what to do? a separator between responses and requests possible?
 
-	this->entries.prepend(Entry(header, smartPayload));
+	this->addEntry(*this->pool.create(header, std::move(payload)), true);
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::Dispatcher::addEntry(Entry& entry, bool prepend)
+{
+	IndexList& bucket = this->getBucket(entry.header.destination,
+			entry.header.source, entry.header.packetIdentifier);
+	if (prepend) {
+		this->pending.prepend(entry);
+		bucket.prepend(entry);
+	} else {
+		this->pending.append(entry);
+		bucket.append(entry);
+	}
+}
+
+void
+xpcc::Dispatcher::setState(Entry& entry, Entry::State state)
+{
+	this->getList(entry.state).remove(entry);
+	entry.state = state;
+	this->getList(state).append(entry);
+}
+
+void
+xpcc::Dispatcher::removeEntry(Entry& entry)
+{
+	this->getList(entry.state).remove(entry);
+	this->getBucket(entry.header.destination, entry.header.source,
+			entry.header.packetIdentifier).remove(entry);
+	this->pool.destroy(&entry);
+}
+
+xpcc::Dispatcher::EntryList&
+xpcc::Dispatcher::getList(Entry::State state)
+{
+	switch (state)
+	{
+		case Entry::State::TransmissionPending:
+			return this->pending;
+		case Entry::State::WaitForACK:
+			return this->waitingForAck;
+		default:
+			return this->waitingForResponse;
+	}
+}
+
+xpcc::Dispatcher::IndexList&
+xpcc::Dispatcher::getBucket(uint8_t source, uint8_t destination, uint8_t identifier)
+{
+	static_assert(IndexSize > 1 and (IndexSize & (IndexSize - 1)) == 0,
+			"The size of the index must be a power of two!");
+	constexpr int shift = 32 - std::countr_zero(IndexSize);
+
+	// Fibonacci hashing of the header triple
+	const uint32_t key = uint32_t(source) << 16 | uint32_t(destination) << 8 | identifier;
+	return this->index[uint32_t(key * 0x9E3779B9u) >> shift];
 }
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace xpcc
+{
+
+/// @cond
+/**
+ * Storage for the entries of the intrusive lists used for bookkeeping.
+ *
+ * The memory of destroyed entries is kept in a free list and reused for new
+ * entries, so that the heap is only used until the maximum number of
+ * simultaneous entries is reached.
+ */
+template <typename T>
+class EntryPool
+{
+public:
+	EntryPool() = default;
+
+	EntryPool(const EntryPool&) = delete;
+
+	EntryPool&
+	operator = (const EntryPool&) = delete;
+
+	~EntryPool()
+	{
+		while (unused != nullptr)
+		{
+			Slot* const slot = unused;
+			unused = slot->next;
+			::operator delete(slot);
+		}
+	}
+
+	template <typename... Args>
+	T*
+	create(Args&&... args)
+	{
+		void* memory;
+		if (unused != nullptr)
+		{
+			memory = unused;
+			unused = unused->next;
+		}
+		else {
+			memory = ::operator new(std::max(sizeof(T), sizeof(Slot)));
+		}
+		return new (memory) T(std::forward<Args>(args)...);
+	}
+
+	void
+	destroy(T* entry)
+	{
+		entry->~T();
+		unused = new (entry) Slot{unused};
+	}
+
+private:
+	struct Slot
+	{
+		Slot* next;
+	};
+
+	Slot* unused = nullptr;
+};
+/// @endcond
+
+}	// namespace xpcc
@@ -18,7 +18,7 @@
 #ifndef	XPCC_RESPONSE_CALLBACK_HPP
 #define	XPCC_RESPONSE_CALLBACK_HPP
 
-#include <modm/container/smart_pointer.hpp>
+#include <modm/container/shared_buffer.hpp>
 
 #include "backend/backend_interface.hpp"
 #include "communicatable.hpp"
@@ -80,7 +80,7 @@ namespace xpcc
 
 		/// \todo check packet size?
 		inline void
-		call(const Header& header, const modm::SmartPointer &payload) const
+		call(const Header& header, const modm::SharedBuffer &payload) const
 		{
 			if (isCallable()) {
 				(component->*function)(header, payload.getPointer());
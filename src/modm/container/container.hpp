@@ -16,10 +16,17 @@
 
 #include "container/linked_list.hpp"
 #include "container/doubly_linked_list.hpp"
+#include "container/intrusive_linked_list.hpp"
+#include "container/intrusive_doubly_linked_list.hpp"
 
 #include "container/dynamic_array.hpp"
+#include "container/static_vector.hpp"
+#include "container/small_vector.hpp"
+#include "container/flat_map.hpp"
+#include "container/static_flat_map.hpp"
 
 #include "container/pair.hpp"
+#include "container/shared_buffer.hpp"
 #include "container/smart_pointer.hpp"
 
 
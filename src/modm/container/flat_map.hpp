@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <modm/architecture/interface/assert.hpp>
+
+namespace modm
+{
+
+/// @cond
+namespace detail
+{
+// Intentionally not constexpr, so that exceeding the capacity of a map in a
+// constant expression fails to compile.
+inline void
+flat_map_capacity_exceeded() {}
+}
+/// @endcond
+
+/**
+ * Sorted associative container with a fixed capacity.
+ *
+ * The elements are stored sorted by key in an array inside the object, so the
+ * map never allocates memory and finds a key with a binary search in
+ * O(log n) time. Inserting and erasing elements moves the elements behind
+ * them, so the map is best suited for lookup tables, which are created once
+ * and then only searched.
+ *
+ * All functions are `constexpr`, so that a table can be created at compile
+ * time and placed in flash:
+ *
+ * \code
+ * constexpr modm::flat_map<uint8_t, Handler, 4> handlers{
+ *     {0x10, &onStatus}, {0x22, &onConfig}, {0x01, &onPing}};
+ *
+ * if (auto it = handlers.find(id); it != handlers.end()) {
+ *     it->second(payload);
+ * }
+ * \endcode
+ *
+ * The keys and values must be default constructible. The key of an element
+ * must not be modified through an iterator.
+ *
+ * \tparam	Key		Type of the keys
+ * \tparam	T		Type of the mapped values
+ * \tparam	N		Capacity
+ * \tparam	Compare	Strict weak ordering of the keys
+ *
+ * \see		modm::static_flat_map
+ * \ingroup	modm_container
+ */
+template<typename Key, typename T, std::size_t N, typename Compare = std::less<Key>>
+class flat_map
+{
+public:
+	using key_type = Key;
+	using mapped_type = T;
+	using value_type = std::pair<Key, T>;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using key_compare = Compare;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using iterator = value_type*;
+	using const_iterator = const value_type*;
+
+	constexpr flat_map() = default;
+
+	/// Inserts the elements, later elements with an existing key are ignored.
+	constexpr
+	flat_map(std::initializer_list<value_type> init)
+	{
+		for (const value_type& value : init)
+		{
+			if (size_ == N and not contains(value.first)) {
+				capacityExceeded();
+			}
+			insert(value);
+		}
+	}
+
+	// Iterators
+	constexpr iterator begin() { return values.data(); }
+	constexpr const_iterator begin() const { return values.data(); }
+	constexpr const_iterator cbegin() const { return values.data(); }
+	constexpr iterator end() { return values.data() + size_; }
+	constexpr const_iterator end() const { return values.data() + size_; }
+	constexpr const_iterator cend() const { return values.data() + size_; }
+
+	// Capacity
+	constexpr bool
+	empty() const { return size_ == 0; }
+
+	constexpr size_type
+	size() const { return size_; }
+
+	static constexpr size_type
+	max_size() { return N; }
+
+	// Lookup
+	constexpr iterator
+	find(const Key& key)
+	{
+		iterator it = lower_bound(key);
+		return (it != end() and not compare(key, it->first)) ? it : end();
+	}
+
+	constexpr const_iterator
+	find(const Key& key) const
+	{
+		return const_cast<flat_map*>(this)->find(key);
+	}
+
+	constexpr bool
+	contains(const Key& key) const
+	{
+		return find(key) != end();
+	}
+
+	constexpr size_type
+	count(const Key& key) const
+	{
+		return contains(key) ? 1 : 0;
+	}
+
+	/// Iterator to the first element whose key is not less than `key`.
+	constexpr iterator
+	lower_bound(const Key& key)
+	{
+		return std::lower_bound(begin(), end(), key,
+				[this](const value_type& value, const Key& k) { return compare(value.first, k); });
+	}
+
+	constexpr const_iterator
+	lower_bound(const Key& key) const
+	{
+		return const_cast<flat_map*>(this)->lower_bound(key);
+	}
+
+	/// Iterator to the first element whose key is greater than `key`.
+	constexpr iterator
+	upper_bound(const Key& key)
+	{
+		return std::upper_bound(begin(), end(), key,
+				[this](const Key& k, const value_type& value) { return compare(k, value.first); });
+	}
+
+	constexpr const_iterator
+	upper_bound(const Key& key) const
+	{
+		return const_cast<flat_map*>(this)->upper_bound(key);
+	}
+
+	/// Access the value of a key, which is inserted if it does not exist yet.
+	/// Inserting into a full map is a failed assertion.
+	constexpr T&
+	operator [] (const Key& key)
+	{
+		auto [it, inserted] = try_emplace(key);
+		if (it == end()) { capacityExceeded(); }
+		return it->second;
+	}
+
+	// Modifiers
+	/**
+	 * Inserts the element, unless its key already exists.
+	 *
+	 * \return	iterator to the element with the key and whether the element
+	 * 			was inserted. The iterator is `end()` if the map is full.
+	 */
+	constexpr std::pair<iterator, bool>
+	insert(const value_type& value)
+	{
+		return try_emplace(value.first, value.second);
+	}
+
+	constexpr std::pair<iterator, bool>
+	insert(value_type&& value)
+	{
+		return try_emplace(std::move(value.first), std::move(value.second));
+	}
+
+	/// Constructs the value from the arguments, unless the key already exists.
+	template<typename K, typename... Args>
+	constexpr std::pair<iterator, bool>
+	try_emplace(K&& key, Args&&... args)
+	{
+		iterator it = lower_bound(key);
+		if (it != end() and not compare(key, it->first)) {
+			return {it, false};
+		}
+		if (size_ == N) {
+			return {end(), false};
+		}
+		std::move_backward(it, end(), end() + 1);
+		*it = value_type(std::piecewise_construct,
+				std::forward_as_tuple(std::forward<K>(key)),
+				std::forward_as_tuple(std::forward<Args>(args)...));
+		size_++;
+		return {it, true};
+	}
+
+	/// Inserts the element or assigns the value if the key already exists.
+	template<typename M>
+	constexpr std::pair<iterator, bool>
+	insert_or_assign(const Key& key, M&& obj)
+	{
+		auto result = try_emplace(key, std::forward<M>(obj));
+		if (not result.second and result.first != end()) {
+			result.first->second = std::forward<M>(obj);
+		}
+		return result;
+	}
+
+	/// \return	iterator to the element following the erased one.
+	constexpr iterator
+	erase(const_iterator position)
+	{
+		iterator it = begin() + (position - begin());
+		std::move(it + 1, end(), it);
+		size_--;
+		values[size_] = value_type();
+		return it;
+	}
+
+	/// \return	number of erased elements, 0 or 1.
+	constexpr size_type
+	erase(const Key& key)
+	{
+		const_iterator it = find(key);
+		if (it == end()) { return 0; }
+		erase(it);
+		return 1;
+	}
+
+	constexpr void
+	clear()
+	{
+		std::fill_n(values.begin(), size_, value_type());
+		size_ = 0;
+	}
+
+	constexpr key_compare
+	key_comp() const { return compare; }
+
+	friend constexpr bool
+	operator == (const flat_map& lhs, const flat_map& rhs)
+	{
+		return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	// Interface of the other modm containers
+	constexpr bool
+	isEmpty() const { return empty(); }
+
+	constexpr bool
+	isFull() const { return size_ == N; }
+
+	constexpr size_type
+	getSize() const { return size_; }
+
+	static constexpr size_type
+	getMaxSize() { return N; }
+
+private:
+	static constexpr void
+	capacityExceeded()
+	{
+		if (std::is_constant_evaluated()) {
+			detail::flat_map_capacity_exceeded();
+		} else {
+			modm_assert(false, "flat_map.full", "The capacity of the flat_map is exceeded!");
+		}
+	}
+
+	std::array<value_type, N> values{};
+	size_type size_{0};
+	[[no_unique_address]] Compare compare{};
+};
+
+}	// namespace modm
@@ -0,0 +1,589 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <modm/architecture/interface/assert.hpp>
+
+namespace modm::detail
+{
+
+/// @cond
+template<typename Allocator>
+struct inline_vector_heap
+{
+	[[no_unique_address]] Allocator allocator{};
+	// nullptr while the elements are stored inline
+	typename std::allocator_traits<Allocator>::pointer data{nullptr};
+	std::size_t capacity{0};
+};
+
+template<>
+struct inline_vector_heap<void>
+{};
+/// @endcond
+
+/**
+ * Vector with inline storage for `N` elements, which is the common
+ * implementation of `modm::static_vector` and `modm::small_vector`.
+ *
+ * If `Allocator` is `void`, the capacity is fixed to `N` elements and
+ * exceeding it is a failed assertion. Otherwise the elements are moved into
+ * memory from the allocator once they no longer fit into the inline storage.
+ *
+ * @ingroup	modm_container
+ */
+template<typename T, std::size_t N, typename Allocator>
+class inline_vector
+{
+	static constexpr bool can_grow = not std::is_void_v<Allocator>;
+	static_assert(can_grow or N > 0, "The capacity of a static_vector must not be zero!");
+
+public:
+	using value_type = T;
+	using allocator_type = Allocator;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	// compatibility with modm::DynamicArray
+	using SizeType = std::size_t;
+
+	inline_vector() = default;
+
+	explicit
+	inline_vector(size_type count)
+	{
+		resize(count);
+	}
+
+	inline_vector(size_type count, const T& value)
+	{
+		assign(count, value);
+	}
+
+	template<std::input_iterator InputIt>
+	inline_vector(InputIt first, InputIt last)
+	{
+		assign(first, last);
+	}
+
+	inline_vector(std::initializer_list<T> init)
+	{
+		assign(init.begin(), init.end());
+	}
+
+	inline_vector(const inline_vector& other)
+	{
+		assign(other.begin(), other.end());
+	}
+
+	inline_vector(inline_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+	{
+		take(other);
+	}
+
+	~inline_vector()
+	{
+		clear();
+		deallocate();
+	}
+
+	inline_vector&
+	operator = (const inline_vector& other)
+	{
+		if (this != &other) {
+			assign(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	inline_vector&
+	operator = (inline_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+	{
+		if (this != &other)
+		{
+			clear();
+			deallocate();
+			take(other);
+		}
+		return *this;
+	}
+
+	inline_vector&
+	operator = (std::initializer_list<T> init)
+	{
+		assign(init.begin(), init.end());
+		return *this;
+	}
+
+	void
+	assign(size_type count, const T& value)
+	{
+		clear();
+		reserve(count);
+		for (; count > 0; --count) {
+			emplace_back(value);
+		}
+	}
+
+	template<std::input_iterator InputIt>
+	void
+	assign(InputIt first, InputIt last)
+	{
+		clear();
+		if constexpr (std::forward_iterator<InputIt>) {
+			reserve(std::distance(first, last));
+		}
+		for (; first != last; ++first) {
+			emplace_back(*first);
+		}
+	}
+
+	void
+	assign(std::initializer_list<T> init)
+	{
+		assign(init.begin(), init.end());
+	}
+
+	// Element access
+	reference
+	operator [] (size_type index)
+	{
+		return data()[index];
+	}
+
+	const_reference
+	operator [] (size_type index) const
+	{
+		return data()[index];
+	}
+
+	reference
+	front() { return data()[0]; }
+
+	const_reference
+	front() const { return data()[0]; }
+
+	reference
+	back() { return data()[size_ - 1]; }
+
+	const_reference
+	back() const { return data()[size_ - 1]; }
+
+	pointer
+	data()
+	{
+		if constexpr (can_grow) {
+			if (heap_.data) { return std::to_address(heap_.data); }
+		}
+		return reinterpret_cast<T*>(storage_);
+	}
+
+	const_pointer
+	data() const
+	{
+		return const_cast<inline_vector*>(this)->data();
+	}
+
+	// Iterators
+	iterator begin() { return data(); }
+	const_iterator begin() const { return data(); }
+	const_iterator cbegin() const { return data(); }
+	iterator end() { return data() + size_; }
+	const_iterator end() const { return data() + size_; }
+	const_iterator cend() const { return data() + size_; }
+
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+	// Capacity
+	bool
+	empty() const { return size_ == 0; }
+
+	size_type
+	size() const { return size_; }
+
+	size_type
+	max_size() const
+	{
+		if constexpr (can_grow) {
+			return std::allocator_traits<Allocator>::max_size(heap_.allocator);
+		} else {
+			return N;
+		}
+	}
+
+	size_type
+	capacity() const
+	{
+		if constexpr (can_grow) {
+			if (heap_.data) { return heap_.capacity; }
+		}
+		return N;
+	}
+
+	/**
+	 * Make sure that `count` elements fit without reallocation.
+	 *
+	 * Without an allocator the capacity is fixed and this function does
+	 * nothing.
+	 */
+	void
+	reserve(size_type count)
+	{
+		if constexpr (can_grow) {
+			if (count > capacity()) { reallocate(count); }
+		}
+	}
+
+	/// Moves the elements back into the inline storage, if they fit.
+	void
+	shrink_to_fit()
+	{
+		if constexpr (can_grow) {
+			if (heap_.data and size_ <= N)
+			{
+				T* const elements = std::to_address(heap_.data);
+				T* const inline_data = reinterpret_cast<T*>(storage_);
+				std::uninitialized_move(elements, elements + size_, inline_data);
+				std::destroy(elements, elements + size_);
+				deallocate();
+			}
+		}
+	}
+
+	// Modifiers
+	void
+	clear()
+	{
+		std::destroy(begin(), end());
+		size_ = 0;
+	}
+
+	iterator
+	insert(const_iterator position, const T& value)
+	{
+		return emplace(position, value);
+	}
+
+	iterator
+	insert(const_iterator position, T&& value)
+	{
+		return emplace(position, std::move(value));
+	}
+
+	iterator
+	insert(const_iterator position, size_type count, const T& value)
+	{
+		const size_type index = position - begin();
+		// value may refer to an element of this vector
+		const inline_vector values(count, value);
+		return insert(begin() + index, values.begin(), values.end());
+	}
+
+	template<std::input_iterator InputIt>
+	iterator
+	insert(const_iterator position, InputIt first, InputIt last)
+	{
+		const size_type index = position - begin();
+		const size_type old_size = size_;
+		for (; first != last; ++first) {
+			emplace_back(*first);
+		}
+		std::rotate(begin() + index, begin() + old_size, end());
+		return begin() + index;
+	}
+
+	iterator
+	insert(const_iterator position, std::initializer_list<T> init)
+	{
+		return insert(position, init.begin(), init.end());
+	}
+
+	template<typename... Args>
+	iterator
+	emplace(const_iterator position, Args&&... args)
+	{
+		const size_type index = position - begin();
+		if (index == size_)
+		{
+			emplace_back(std::forward<Args>(args)...);
+			return begin() + index;
+		}
+		// the arguments may refer to an element of this vector
+		T value(std::forward<Args>(args)...);
+		emplace_back(std::move(back()));
+		T* const elements = data();
+		std::move_backward(elements + index, elements + size_ - 2, elements + size_ - 1);
+		elements[index] = std::move(value);
+		return elements + index;
+	}
+
+	iterator
+	erase(const_iterator position)
+	{
+		return erase(position, position + 1);
+	}
+
+	iterator
+	erase(const_iterator first, const_iterator last)
+	{
+		T* const from = begin() + (first - begin());
+		T* const to = begin() + (last - begin());
+		if (from != to)
+		{
+			T* const new_end = std::move(to, end(), from);
+			std::destroy(new_end, end());
+			size_ -= to - from;
+		}
+		return from;
+	}
+
+	void
+	push_back(const T& value)
+	{
+		emplace_back(value);
+	}
+
+	void
+	push_back(T&& value)
+	{
+		emplace_back(std::move(value));
+	}
+
+	template<typename... Args>
+	reference
+	emplace_back(Args&&... args)
+	{
+		if constexpr (can_grow)
+		{
+			if (size_ == capacity()) {
+				return grow_emplace_back(std::forward<Args>(args)...);
+			}
+		}
+		else {
+			modm_assert(size_ < N, "vector.full", "static_vector is full!", size_);
+		}
+		T* const element = std::construct_at(data() + size_, std::forward<Args>(args)...);
+		size_++;
+		return *element;
+	}
+
+	void
+	pop_back()
+	{
+		size_--;
+		std::destroy_at(data() + size_);
+	}
+
+	void
+	resize(size_type count)
+	{
+		resize_impl(count);
+	}
+
+	void
+	resize(size_type count, const T& value)
+	{
+		if (count <= size_) {
+			resize_impl(count);
+			return;
+		}
+		// value may refer to an element of this vector, which is moved when
+		// growing, so the copies are made from a copy
+		const T copy(value);
+		resize_impl(count, copy);
+	}
+
+	void
+	swap(inline_vector& other)
+	{
+		inline_vector tmp(std::move(other));
+		other = std::move(*this);
+		*this = std::move(tmp);
+	}
+
+	friend void
+	swap(inline_vector& lhs, inline_vector& rhs)
+	{
+		lhs.swap(rhs);
+	}
+
+	friend bool
+	operator == (const inline_vector& lhs, const inline_vector& rhs)
+	{
+		return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	// Interface of the other modm containers
+	bool
+	isEmpty() const { return empty(); }
+
+	bool
+	isFull() const { return size_ == capacity(); }
+
+	size_type
+	getSize() const { return size_; }
+
+	size_type
+	getCapacity() const { return capacity(); }
+
+	size_type
+	getMaxSize() const { return max_size(); }
+
+	/// Appends an element, returns `false` if a static_vector is full.
+	bool
+	append(const T& value)
+	{
+		if constexpr (not can_grow) {
+			if (size_ == N) { return false; }
+		}
+		emplace_back(value);
+		return true;
+	}
+
+	/// Appends an element, returns `false` if a static_vector is full.
+	bool
+	append(T&& value)
+	{
+		if constexpr (not can_grow) {
+			if (size_ == N) { return false; }
+		}
+		emplace_back(std::move(value));
+		return true;
+	}
+
+	void
+	removeBack() { pop_back(); }
+
+	void
+	removeAll() { clear(); }
+
+	reference
+	getFront() { return front(); }
+
+	const_reference
+	getFront() const { return front(); }
+
+	reference
+	getBack() { return back(); }
+
+	const_reference
+	getBack() const { return back(); }
+
+private:
+	template<typename... Args>
+	void
+	resize_impl(size_type count, const Args&... value)
+	{
+		if (count < size_)
+		{
+			std::destroy(begin() + count, end());
+			size_ = count;
+			return;
+		}
+		reserve(count);
+		while (size_ < count) {
+			emplace_back(value...);
+		}
+	}
+
+	// Only called if the vector is full, the new element is constructed before
+	// the old elements are moved, since the arguments may refer to them.
+	template<typename... Args>
+	reference
+	grow_emplace_back(Args&&... args)
+	{
+		using traits = std::allocator_traits<Allocator>;
+		const size_type new_capacity = std::max<size_type>(2 * capacity(), 1);
+		auto memory = traits::allocate(heap_.allocator, new_capacity);
+		T* const elements = std::to_address(memory);
+		T* const element = std::construct_at(elements + size_, std::forward<Args>(args)...);
+		std::uninitialized_move(begin(), end(), elements);
+		std::destroy(begin(), end());
+		deallocate();
+		heap_.data = memory;
+		heap_.capacity = new_capacity;
+		size_++;
+		return *element;
+	}
+
+	void
+	reallocate(size_type new_capacity)
+	{
+		using traits = std::allocator_traits<Allocator>;
+		auto memory = traits::allocate(heap_.allocator, new_capacity);
+		std::uninitialized_move(begin(), end(), std::to_address(memory));
+		std::destroy(begin(), end());
+		deallocate();
+		heap_.data = memory;
+		heap_.capacity = new_capacity;
+	}
+
+	void
+	deallocate()
+	{
+		if constexpr (can_grow)
+		{
+			if (heap_.data)
+			{
+				std::allocator_traits<Allocator>::deallocate(
+						heap_.allocator, heap_.data, heap_.capacity);
+				heap_.data = nullptr;
+				heap_.capacity = 0;
+			}
+		}
+	}
+
+	// Move construction into an empty vector. Heap memory is taken over, the
+	// elements in the inline storage of the other vector must be moved.
+	void
+	take(inline_vector& other)
+	{
+		if constexpr (can_grow)
+		{
+			if (other.heap_.data)
+			{
+				heap_.data = std::exchange(other.heap_.data, nullptr);
+				heap_.capacity = std::exchange(other.heap_.capacity, 0);
+				size_ = std::exchange(other.size_, 0);
+				return;
+			}
+		}
+		std::uninitialized_move(other.begin(), other.end(), data());
+		size_ = other.size_;
+		other.clear();
+	}
+
+	alignas(T) std::byte storage_[sizeof(T) * std::max<std::size_t>(N, 1)];
+	size_type size_{0};
+	[[no_unique_address]] inline_vector_heap<Allocator> heap_;
+};
+
+}	// namespace modm::detail
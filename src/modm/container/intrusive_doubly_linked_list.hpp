@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace modm
+{
+
+/**
+ * Hook of an element in a `modm::IntrusiveDoublyLinkedList`.
+ *
+ * Copying an element does not copy its membership in a list, the hook of the
+ * copy is unlinked.
+ *
+ * @ingroup	modm_container
+ */
+template <typename T>
+class IntrusiveDoublyLinkedListHook
+{
+	template <typename U, IntrusiveDoublyLinkedListHook<U> U::*>
+	friend class IntrusiveDoublyLinkedList;
+
+public:
+	IntrusiveDoublyLinkedListHook() = default;
+	IntrusiveDoublyLinkedListHook(const IntrusiveDoublyLinkedListHook&) {}
+
+	IntrusiveDoublyLinkedListHook&
+	operator = (const IntrusiveDoublyLinkedListHook&) { return *this; }
+
+private:
+	T* next = nullptr;
+	T* previous = nullptr;
+};
+
+/**
+ * Intrusive doubly-linked list.
+ *
+ * The list links existing elements through a hook member instead of
+ * allocating a node for a copy of each element. Inserting and removing
+ * elements therefore never allocates memory, but the elements must outlive
+ * their membership in the list and can only be in one list per hook.
+ *
+ * Any element can be removed in O(1) time, either by iterator or by reference.
+ *
+ * \tparam	T		Type of list entries
+ * \tparam	Hook	Hook member of the entries
+ *
+ * \see		modm::IntrusiveLinkedList
+ * \ingroup	modm_container
+ */
+template <typename T, IntrusiveDoublyLinkedListHook<T> T::*Hook = &T::hook>
+class IntrusiveDoublyLinkedList
+{
+	template <typename U>
+	class Iterator
+	{
+		friend class IntrusiveDoublyLinkedList;
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = U*;
+		using reference = U&;
+
+		Iterator() = default;
+
+		// conversion from iterator to const_iterator
+		template <typename V>
+		Iterator(const Iterator<V>& other) :
+			node(other.node), list(other.list)
+		{}
+
+		Iterator&
+		operator ++ ()
+		{
+			node = (node->*Hook).next;
+			return *this;
+		}
+
+		Iterator
+		operator ++ (int)
+		{
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+
+		Iterator&
+		operator -- ()
+		{
+			node = node ? (node->*Hook).previous : list->back;
+			return *this;
+		}
+
+		Iterator
+		operator -- (int)
+		{
+			Iterator old = *this;
+			--*this;
+			return old;
+		}
+
+		bool
+		operator == (const Iterator& other) const
+		{
+			return node == other.node;
+		}
+
+		U&
+		operator * () const
+		{
+			return *node;
+		}
+
+		U*
+		operator -> () const
+		{
+			return node;
+		}
+
+	private:
+		template <typename>
+		friend class Iterator;
+
+		Iterator(U* node, const IntrusiveDoublyLinkedList* list) :
+			node(node), list(list)
+		{}
+
+		U* node = nullptr;
+		// required to decrement the end() iterator
+		const IntrusiveDoublyLinkedList* list = nullptr;
+	};
+
+public:
+	using iterator = Iterator<T>;
+	using const_iterator = Iterator<const T>;
+	using Size = std::size_t;
+
+	IntrusiveDoublyLinkedList() = default;
+
+	IntrusiveDoublyLinkedList(const IntrusiveDoublyLinkedList&) = delete;
+
+	IntrusiveDoublyLinkedList&
+	operator = (const IntrusiveDoublyLinkedList&) = delete;
+
+	/// check if there are any elements in the list
+	bool
+	isEmpty() const
+	{
+		return front == nullptr;
+	}
+
+	/// Get number of elements in the list
+	std::size_t
+	getSize() const
+	{
+		return size;
+	}
+
+	/// Insert in front
+	void
+	prepend(T& value)
+	{
+		link(value, nullptr, front);
+	}
+
+	/// Insert at the end of the list
+	void
+	append(T& value)
+	{
+		link(value, back, nullptr);
+	}
+
+	/**
+	 * Insert an element after the position iterator, or at the end of the
+	 * list if the iterator is `end()`.
+	 *
+	 * This behavior is compatible with modm::DoublyLinkedList.
+	 *
+	 * \return	iterator pointing to the inserted element
+	 */
+	iterator
+	insert(iterator position, T& value)
+	{
+		if (position.node == nullptr) {
+			append(value);
+		} else {
+			link(value, position.node, (position.node->*Hook).next);
+		}
+		return iterator(&value, this);
+	}
+
+	/// Unlink the first element
+	void
+	removeFront()
+	{
+		remove(*front);
+	}
+
+	/// Unlink the last element
+	void
+	removeBack()
+	{
+		remove(*back);
+	}
+
+	/**
+	 * Unlink the element pointed to by the iterator and return an iterator
+	 * to the element behind it.
+	 *
+	 * Only the iterators to the removed element are invalidated.
+	 */
+	iterator
+	remove(iterator position)
+	{
+		T* const next = (position.node->*Hook).next;
+		remove(*position.node);
+		return iterator(next, this);
+	}
+
+	/// Unlink the element, which must be part of this list.
+	void
+	remove(T& value)
+	{
+		IntrusiveDoublyLinkedListHook<T>& hook = value.*Hook;
+		if (hook.previous == nullptr) {
+			front = hook.next;
+		} else {
+			(hook.previous->*Hook).next = hook.next;
+		}
+		if (hook.next == nullptr) {
+			back = hook.previous;
+		} else {
+			(hook.next->*Hook).previous = hook.previous;
+		}
+		hook.next = nullptr;
+		hook.previous = nullptr;
+		size--;
+	}
+
+	/// Unlink all elements
+	void
+	removeAll()
+	{
+		while (front != nullptr) {
+			removeFront();
+		}
+	}
+
+	T&
+	getFront()
+	{
+		return *front;
+	}
+
+	const T&
+	getFront() const
+	{
+		return *front;
+	}
+
+	T&
+	getBack()
+	{
+		return *back;
+	}
+
+	const T&
+	getBack() const
+	{
+		return *back;
+	}
+
+	iterator
+	begin()
+	{
+		return iterator(front, this);
+	}
+
+	const_iterator
+	begin() const
+	{
+		return const_iterator(front, this);
+	}
+
+	iterator
+	end()
+	{
+		return iterator(nullptr, this);
+	}
+
+	const_iterator
+	end() const
+	{
+		return const_iterator(nullptr, this);
+	}
+
+private:
+	void
+	link(T& value, T* previous, T* next)
+	{
+		(value.*Hook).previous = previous;
+		(value.*Hook).next = next;
+		if (previous == nullptr) {
+			front = &value;
+		} else {
+			(previous->*Hook).next = &value;
+		}
+		if (next == nullptr) {
+			back = &value;
+		} else {
+			(next->*Hook).previous = &value;
+		}
+		size++;
+	}
+
+	T* front = nullptr;
+	T* back = nullptr;
+	std::size_t size = 0;
+};
+
+}	// namespace modm
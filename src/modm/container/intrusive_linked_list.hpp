@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace modm
+{
+
+/**
+ * Hook of an element in a `modm::IntrusiveLinkedList`.
+ *
+ * Copying an element does not copy its membership in a list, the hook of the
+ * copy is unlinked.
+ *
+ * @ingroup	modm_container
+ */
+template <typename T>
+class IntrusiveLinkedListHook
+{
+	template <typename U, IntrusiveLinkedListHook<U> U::*>
+	friend class IntrusiveLinkedList;
+
+public:
+	IntrusiveLinkedListHook() = default;
+	IntrusiveLinkedListHook(const IntrusiveLinkedListHook&) {}
+
+	IntrusiveLinkedListHook&
+	operator = (const IntrusiveLinkedListHook&) { return *this; }
+
+private:
+	T* next = nullptr;
+};
+
+/**
+ * Intrusive singly-linked list.
+ *
+ * The list links existing elements through a hook member instead of
+ * allocating a node for a copy of each element. Appending, prepending and
+ * removing elements therefore never allocates memory, but the elements must
+ * outlive their membership in the list and can only be in one list per hook.
+ *
+ * The list stores pointers to its first and last element, and its iterators
+ * know the previous element, so that `remove(iterator)` takes O(1) time.
+ *
+ * \code
+ * struct Message
+ * {
+ *     modm::IntrusiveLinkedListHook<Message> hook;
+ *     uint8_t data[8];
+ * };
+ * modm::IntrusiveLinkedList<Message> list;
+ * Message message;
+ * list.append(message);
+ * \endcode
+ *
+ * \tparam	T		Type of list entries
+ * \tparam	Hook	Hook member of the entries
+ *
+ * \ingroup	modm_container
+ */
+template <typename T, IntrusiveLinkedListHook<T> T::*Hook = &T::hook>
+class IntrusiveLinkedList
+{
+	template <typename U>
+	class Iterator
+	{
+		friend class IntrusiveLinkedList;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = U*;
+		using reference = U&;
+
+		Iterator() = default;
+
+		// conversion from iterator to const_iterator
+		template <typename V>
+		Iterator(const Iterator<V>& other) :
+			node(other.node), previous(other.previous)
+		{}
+
+		Iterator&
+		operator ++ ()
+		{
+			previous = node;
+			node = (node->*Hook).next;
+			return *this;
+		}
+
+		Iterator
+		operator ++ (int)
+		{
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+
+		bool
+		operator == (const Iterator& other) const
+		{
+			return node == other.node;
+		}
+
+		U&
+		operator * () const
+		{
+			return *node;
+		}
+
+		U*
+		operator -> () const
+		{
+			return node;
+		}
+
+	private:
+		template <typename>
+		friend class Iterator;
+
+		Iterator(U* node, U* previous) :
+			node(node), previous(previous)
+		{}
+
+		U* node = nullptr;
+		U* previous = nullptr;
+	};
+
+public:
+	using iterator = Iterator<T>;
+	using const_iterator = Iterator<const T>;
+	using Size = std::size_t;
+
+	IntrusiveLinkedList() = default;
+
+	IntrusiveLinkedList(const IntrusiveLinkedList&) = delete;
+
+	IntrusiveLinkedList&
+	operator = (const IntrusiveLinkedList&) = delete;
+
+	/// check if there are any elements in the list
+	bool
+	isEmpty() const
+	{
+		return front == nullptr;
+	}
+
+	/// Get number of elements in the list
+	std::size_t
+	getSize() const
+	{
+		return size;
+	}
+
+	/// Insert in front
+	void
+	prepend(T& value)
+	{
+		(value.*Hook).next = front;
+		front = &value;
+		if (back == nullptr) {
+			back = &value;
+		}
+		size++;
+	}
+
+	/// Insert at the end of the list
+	void
+	append(T& value)
+	{
+		(value.*Hook).next = nullptr;
+		if (back == nullptr) {
+			front = &value;
+		} else {
+			(back->*Hook).next = &value;
+		}
+		back = &value;
+		size++;
+	}
+
+	/**
+	 * Insert an element after the position iterator, or at the end of the
+	 * list if the iterator is `end()`.
+	 *
+	 * \return	iterator pointing to the inserted element
+	 */
+	iterator
+	insert(iterator position, T& value)
+	{
+		if (position.node == nullptr) {
+			T* const last = back;
+			append(value);
+			return iterator(&value, last);
+		}
+		(value.*Hook).next = (position.node->*Hook).next;
+		(position.node->*Hook).next = &value;
+		if (back == position.node) {
+			back = &value;
+		}
+		size++;
+		return iterator(&value, position.node);
+	}
+
+	/// Unlink the first element
+	void
+	removeFront()
+	{
+		T* const first = front;
+		front = (first->*Hook).next;
+		if (front == nullptr) {
+			back = nullptr;
+		}
+		(first->*Hook).next = nullptr;
+		size--;
+	}
+
+	/**
+	 * Unlink the element pointed to by the iterator and return an iterator
+	 * to the element behind it.
+	 *
+	 * The iterators to the removed element and to the element behind it are
+	 * invalidated.
+	 */
+	iterator
+	remove(iterator position)
+	{
+		T* const node = position.node;
+		T* const next = (node->*Hook).next;
+		if (position.previous == nullptr) {
+			front = next;
+		} else {
+			(position.previous->*Hook).next = next;
+		}
+		if (back == node) {
+			back = position.previous;
+		}
+		(node->*Hook).next = nullptr;
+		size--;
+		return iterator(next, position.previous);
+	}
+
+	/// Unlink all elements
+	void
+	removeAll()
+	{
+		while (front != nullptr) {
+			removeFront();
+		}
+	}
+
+	T&
+	getFront()
+	{
+		return *front;
+	}
+
+	const T&
+	getFront() const
+	{
+		return *front;
+	}
+
+	T&
+	getBack()
+	{
+		return *back;
+	}
+
+	const T&
+	getBack() const
+	{
+		return *back;
+	}
+
+	iterator
+	begin()
+	{
+		return iterator(front, nullptr);
+	}
+
+	const_iterator
+	begin() const
+	{
+		return const_iterator(front, nullptr);
+	}
+
+	iterator
+	end()
+	{
+		return iterator(nullptr, back);
+	}
+
+	const_iterator
+	end() const
+	{
+		return const_iterator(nullptr, back);
+	}
+
+private:
+	T* front = nullptr;
+	T* back = nullptr;
+	std::size_t size = 0;
+};
+
+}	// namespace modm
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "shared_buffer.hpp"
+
+#include <new>
+
+namespace
+{
+	// Released slabs, linked through their own storage
+	struct Slab
+	{
+		Slab *next;
+	};
+
+	Slab *unusedSlabs = nullptr;
+}
+
+// ----------------------------------------------------------------------------
+void
+modm::SharedBuffer::reserve(std::size_t slabs)
+{
+	for (; slabs > 0; slabs--) {
+		unusedSlabs = new (::operator new(Block::Size + SlabCapacity)) Slab{unusedSlabs};
+	}
+}
+
+modm::SharedBuffer::SharedBuffer(uint16_t size) :
+	block(size ? allocate(size) : nullptr)
+{
+}
+
+modm::SharedBuffer::SharedBuffer(const void *data, uint16_t size) :
+	SharedBuffer(size)
+{
+	if (size) {
+		std::memcpy(block->data(), data, size);
+	}
+}
+
+// ----------------------------------------------------------------------------
+modm::SharedBuffer::Block *
+modm::SharedBuffer::allocate(uint16_t size)
+{
+	void *memory;
+	if (size > SlabCapacity) {
+		memory = ::operator new(Block::Size + size);
+	}
+	else if (unusedSlabs != nullptr)
+	{
+		memory = unusedSlabs;
+		unusedSlabs = unusedSlabs->next;
+	}
+	else {
+		memory = ::operator new(Block::Size + SlabCapacity);
+	}
+	return new (memory) Block{1, size};
+}
+
+void
+modm::SharedBuffer::deallocate(Block *block)
+{
+	if (block->size > SlabCapacity) {
+		::operator delete(block);
+	}
+	else {
+		unusedSlabs = new (block) Slab{unusedSlabs};
+	}
+}
+
+// ----------------------------------------------------------------------------
+modm::IOStream&
+modm::operator << (modm::IOStream& s, const modm::SharedBuffer& buffer)
+{
+	s << "0x" << modm::hex;
+	for (uint16_t i = 0; i < buffer.getSize(); i++)
+	{
+		s << buffer.getPointer()[i];
+	}
+	s << modm::ascii;
+	return s;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <modm/io/iostream.hpp>
+
+namespace modm
+{
+
+/**
+ * Reference counted byte buffer with pooled storage.
+ *
+ * Copies of a buffer share the same storage, which is released when the last
+ * copy is destroyed. Moving a buffer does not touch the reference count.
+ *
+ * Buffers of up to `SlabCapacity` bytes are taken from a pool of fixed-size
+ * slabs. Released slabs are kept in a free list and reused, so that the heap
+ * is only used until the maximum number of simultaneous buffers is reached.
+ * `reserve()` allocates slabs up front, for example during startup. Larger
+ * buffers are allocated from the heap individually. Empty buffers do not
+ * allocate any memory.
+ *
+ * A buffer can be created with uninitialized storage and filled afterwards,
+ * so that a driver receives data directly into it:
+ *
+ * \code
+ * modm::SharedBuffer payload(message.length);
+ * std::memcpy(payload.getPointer(), message.data, message.length);
+ * \endcode
+ *
+ * The reference count and the pool are not protected against concurrent
+ * access, a buffer must only be used from one thread and not from interrupts.
+ *
+ * \ingroup	modm_container
+ */
+class SharedBuffer
+{
+public:
+	/// Number of payload bytes of the pooled slabs
+	static constexpr uint16_t SlabCapacity = 56;
+
+	/// Allocates `slabs` unused slabs, so that the pool does not need to use
+	/// the heap until that many buffers exist at the same time.
+	static void
+	reserve(std::size_t slabs);
+
+	/// Empty buffer without storage
+	SharedBuffer() = default;
+
+	/// Buffer with `size` bytes of uninitialized storage
+	explicit
+	SharedBuffer(uint16_t size);
+
+	/// Buffer with a copy of `size` bytes at `data`
+	SharedBuffer(const void *data, uint16_t size);
+
+	/// Buffer with a copy of the object at `data`
+	template<typename T>
+	explicit
+	SharedBuffer(const T *data) :
+		SharedBuffer(static_cast<const void *>(data), sizeof(T))
+	{
+	}
+
+	SharedBuffer(const SharedBuffer& other) :
+		block(other.block)
+	{
+		if (block) { block->references++; }
+	}
+
+	SharedBuffer(SharedBuffer&& other) :
+		block(std::exchange(other.block, nullptr))
+	{
+	}
+
+	~SharedBuffer()
+	{
+		release();
+	}
+
+	SharedBuffer&
+	operator = (const SharedBuffer& other)
+	{
+		if (other.block) { other.block->references++; }
+		release();
+		block = other.block;
+		return *this;
+	}
+
+	SharedBuffer&
+	operator = (SharedBuffer&& other)
+	{
+		if (this != &other)
+		{
+			release();
+			block = std::exchange(other.block, nullptr);
+		}
+		return *this;
+	}
+
+	/// Pointer to the data, valid even for empty buffers
+	const uint8_t *
+	getPointer() const
+	{
+		return block ? block->data() : &empty;
+	}
+
+	uint8_t *
+	getPointer()
+	{
+		return block ? block->data() : &empty;
+	}
+
+	uint16_t
+	getSize() const
+	{
+		return block ? block->size : 0;
+	}
+
+	bool
+	isEmpty() const
+	{
+		return getSize() == 0;
+	}
+
+	/// Number of buffers sharing the storage, 0 for empty buffers
+	uint16_t
+	getReferenceCount() const
+	{
+		return block ? block->references : 0;
+	}
+
+	/**
+	 * Get the stored data casted to the given type.
+	 * \note This method does not check the size, use get(T&) for that.
+	 */
+	template<typename T>
+	const T&
+	get() const
+	{
+		return *reinterpret_cast<const T *>(getPointer());
+	}
+
+	/**
+	 * Copy the stored data into `value`, if the size matches.
+	 *
+	 * \return \c true if the size of the type fits
+	 */
+	template<typename T>
+	bool
+	get(T& value) const
+	{
+		if (sizeof(T) != getSize()) {
+			return false;
+		}
+		std::memcpy(&value, getPointer(), sizeof(T));
+		return true;
+	}
+
+	/// Buffers are equal if they share the same storage.
+	bool
+	operator == (const SharedBuffer& other) const
+	{
+		return block == other.block;
+	}
+
+private:
+	struct Block
+	{
+		uint16_t references;
+		uint16_t size;
+
+		// The data follows the header with the alignment of scalar types
+		static constexpr std::size_t Size =
+				std::max(sizeof(uint16_t) * 2, alignof(std::max_align_t));
+
+		uint8_t *
+		data()
+		{
+			return reinterpret_cast<uint8_t *>(this) + Size;
+		}
+	};
+
+	void
+	release()
+	{
+		if (block and --block->references == 0) {
+			deallocate(block);
+		}
+	}
+
+	static Block *
+	allocate(uint16_t size);
+
+	static void
+	deallocate(Block *block);
+
+	Block *block = nullptr;
+
+	static inline uint8_t empty = 0;
+};
+
+modm::IOStream&
+operator << (modm::IOStream& s, const modm::SharedBuffer& buffer);
+
+}	// namespace modm
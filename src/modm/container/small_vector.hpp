@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "inline_vector.hpp"
+
+namespace modm
+{
+
+/**
+ * Vector with inline storage for a small number of elements.
+ *
+ * Up to `N` elements are stored inside the object without allocating memory.
+ * When more elements are added, they are moved into memory from the
+ * allocator, which grows by a factor of two. Moving a vector with allocated
+ * memory only moves the pointer to the memory.
+ *
+ * This is useful for collections whose size is usually small, but which must
+ * not be limited at compile time. The vector has the interface of
+ * `std::vector` and the common interface of the modm containers.
+ *
+ * \tparam	T			Type of the elements
+ * \tparam	N			Number of elements stored inline
+ * \tparam	Allocator	Allocator used when more than `N` elements are stored
+ *
+ * \see		modm::static_vector
+ * \ingroup	modm_container
+ */
+template<typename T, std::size_t N, typename Allocator = std::allocator<T>>
+using small_vector = detail::inline_vector<T, N, Allocator>;
+
+}	// namespace modm
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "flat_map.hpp"
+
+namespace modm
+{
+
+/**
+ * Hash function of `modm::static_flat_map`.
+ *
+ * Integral and enumeration keys are used directly and can be hashed in
+ * constant expressions, since the map mixes the bits of the hash itself.
+ * Integral keys wider than `std::size_t` are folded to its width, for example
+ * 32-bit keys on AVR.
+ * All other keys are hashed with `std::hash`.
+ *
+ * @ingroup	modm_container
+ */
+template<typename Key>
+struct flat_hash
+{
+	constexpr std::size_t
+	operator () (const Key& key) const
+	{
+		if constexpr (std::is_enum_v<Key>) {
+			return static_cast<std::size_t>(std::to_underlying(key));
+		} else if constexpr (std::is_integral_v<Key>) {
+			if constexpr (sizeof(Key) > sizeof(std::size_t)) {
+				// fold the upper halves, which would otherwise be cut off
+				using U = std::make_unsigned_t<Key>;
+				U value = static_cast<U>(key);
+				for (std::size_t shift = sizeof(U) * 4; shift >= sizeof(std::size_t) * 8; shift /= 2) {
+					value ^= value >> shift;
+				}
+				return static_cast<std::size_t>(value);
+			} else {
+				return static_cast<std::size_t>(key);
+			}
+		} else {
+			return std::hash<Key>{}(key);
+		}
+	}
+};
+
+/**
+ * Unordered associative container with a fixed capacity.
+ *
+ * The elements are stored in a hash table with open addressing and linear
+ * probing inside the object, so the map never allocates memory and finds,
+ * inserts and erases a key in O(1) time on average. The table has at least
+ * 25% more slots than the capacity, rounded up to a power of two, which keeps
+ * the probe sequences short even if the map is full. Erased elements are
+ * removed by moving the following elements of the probe sequence back, so
+ * that the table does not fill up with deleted markers.
+ *
+ * All functions are `constexpr`, so that a table can be created at compile
+ * time and placed in flash:
+ *
+ * \code
+ * constexpr modm::static_flat_map<uint16_t, Handler, 8> handlers{
+ *     {0x0100, &onStatus}, {0x0220, &onConfig}, {0x0001, &onPing}};
+ *
+ * if (auto it = handlers.find(id); it != handlers.end()) {
+ *     it->second(payload);
+ * }
+ * \endcode
+ *
+ * The keys and values must be default constructible. The key of an element
+ * must not be modified through an iterator. The iteration order is
+ * unspecified.
+ *
+ * \tparam	Key		Type of the keys
+ * \tparam	T		Type of the mapped values
+ * \tparam	N		Capacity
+ * \tparam	Hash	Hash function of the keys
+ * \tparam	KeyEqual	Equality of the keys
+ *
+ * \see		modm::flat_map
+ * \ingroup	modm_container
+ */
+template<typename Key, typename T, std::size_t N,
+		 typename Hash = flat_hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class static_flat_map
+{
+	static constexpr std::size_t Slots = std::bit_ceil(N + N / 4 + 1);
+	static constexpr std::size_t Mask = Slots - 1;
+	// The home slot is taken from the upper bits of a 32-bit hash, also on
+	// targets with a 16-bit std::size_t.
+	static_assert(uint64_t(Slots) <= (uint64_t(1) << 31), "The capacity is too large!");
+	static constexpr uint32_t Shift = 32 - std::countr_zero(Slots);
+
+	template<bool Const>
+	class Iterator
+	{
+		friend class static_flat_map;
+		using Map = std::conditional_t<Const, const static_flat_map, static_flat_map>;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::pair<Key, T>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+		using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+		constexpr Iterator() = default;
+
+		// conversion from iterator to const_iterator
+		template<bool OtherConst>
+		constexpr
+		Iterator(const Iterator<OtherConst>& other) :
+			map(other.map), index(other.index)
+		{}
+
+		constexpr Iterator&
+		operator ++ ()
+		{
+			index = map->next(index + 1);
+			return *this;
+		}
+
+		constexpr Iterator
+		operator ++ (int)
+		{
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+
+		constexpr bool
+		operator == (const Iterator& other) const
+		{
+			return index == other.index;
+		}
+
+		constexpr reference
+		operator * () const
+		{
+			return map->slots[index];
+		}
+
+		constexpr pointer
+		operator -> () const
+		{
+			return &map->slots[index];
+		}
+
+	private:
+		template<bool>
+		friend class Iterator;
+
+		constexpr
+		Iterator(Map* map, std::size_t index) :
+			map(map), index(index)
+		{}
+
+		Map* map = nullptr;
+		std::size_t index = Slots;
+	};
+
+public:
+	using key_type = Key;
+	using mapped_type = T;
+	using value_type = std::pair<Key, T>;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using hasher = Hash;
+	using key_equal = KeyEqual;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	constexpr static_flat_map() = default;
+
+	/// Inserts the elements, later elements with an existing key are ignored.
+	constexpr
+	static_flat_map(std::initializer_list<value_type> init)
+	{
+		for (const value_type& value : init)
+		{
+			if (size_ == N and not contains(value.first)) {
+				capacityExceeded();
+			}
+			insert(value);
+		}
+	}
+
+	// Iterators
+	constexpr iterator begin() { return iterator(this, next(0)); }
+	constexpr const_iterator begin() const { return const_iterator(this, next(0)); }
+	constexpr const_iterator cbegin() const { return begin(); }
+	constexpr iterator end() { return iterator(this, Slots); }
+	constexpr const_iterator end() const { return const_iterator(this, Slots); }
+	constexpr const_iterator cend() const { return end(); }
+
+	// Capacity
+	constexpr bool
+	empty() const { return size_ == 0; }
+
+	constexpr size_type
+	size() const { return size_; }
+
+	static constexpr size_type
+	max_size() { return N; }
+
+	// Lookup
+	constexpr iterator
+	find(const Key& key)
+	{
+		const std::size_t index = probe(key);
+		return used[index] ? iterator(this, index) : end();
+	}
+
+	constexpr const_iterator
+	find(const Key& key) const
+	{
+		const std::size_t index = probe(key);
+		return used[index] ? const_iterator(this, index) : end();
+	}
+
+	constexpr bool
+	contains(const Key& key) const
+	{
+		return used[probe(key)];
+	}
+
+	constexpr size_type
+	count(const Key& key) const
+	{
+		return contains(key) ? 1 : 0;
+	}
+
+	/// Access the value of a key, which is inserted if it does not exist yet.
+	/// Inserting into a full map is a failed assertion.
+	constexpr T&
+	operator [] (const Key& key)
+	{
+		auto [it, inserted] = try_emplace(key);
+		if (it == end()) { capacityExceeded(); }
+		return it->second;
+	}
+
+	// Modifiers
+	/**
+	 * Inserts the element, unless its key already exists.
+	 *
+	 * \return	iterator to the element with the key and whether the element
+	 * 			was inserted. The iterator is `end()` if the map is full.
+	 */
+	constexpr std::pair<iterator, bool>
+	insert(const value_type& value)
+	{
+		return try_emplace(value.first, value.second);
+	}
+
+	constexpr std::pair<iterator, bool>
+	insert(value_type&& value)
+	{
+		return try_emplace(std::move(value.first), std::move(value.second));
+	}
+
+	/// Constructs the value from the arguments, unless the key already exists.
+	template<typename K, typename... Args>
+	constexpr std::pair<iterator, bool>
+	try_emplace(K&& key, Args&&... args)
+	{
+		const std::size_t index = probe(key);
+		if (used[index]) {
+			return {iterator(this, index), false};
+		}
+		if (size_ == N) {
+			return {end(), false};
+		}
+		slots[index] = value_type(std::piecewise_construct,
+				std::forward_as_tuple(std::forward<K>(key)),
+				std::forward_as_tuple(std::forward<Args>(args)...));
+		used[index] = true;
+		size_++;
+		return {iterator(this, index), true};
+	}
+
+	/// Inserts the element or assigns the value if the key already exists.
+	template<typename M>
+	constexpr std::pair<iterator, bool>
+	insert_or_assign(const Key& key, M&& obj)
+	{
+		auto result = try_emplace(key, std::forward<M>(obj));
+		if (not result.second and result.first != end()) {
+			result.first->second = std::forward<M>(obj);
+		}
+		return result;
+	}
+
+	/**
+	 * Erases the element.
+	 *
+	 * In contrast to `std::unordered_map` no iterator is returned, since the
+	 * following elements of the probe sequence may be moved into the slot of
+	 * the erased element. All iterators are invalidated.
+	 */
+	constexpr void
+	erase(const_iterator position)
+	{
+		eraseSlot(position.index);
+	}
+
+	/// \return	number of erased elements, 0 or 1.
+	constexpr size_type
+	erase(const Key& key)
+	{
+		const std::size_t index = probe(key);
+		if (not used[index]) { return 0; }
+		eraseSlot(index);
+		return 1;
+	}
+
+	constexpr void
+	clear()
+	{
+		slots.fill(value_type());
+		used.fill(false);
+		size_ = 0;
+	}
+
+	constexpr hasher
+	hash_function() const { return hash; }
+
+	constexpr key_equal
+	key_eq() const { return equal; }
+
+	// Interface of the other modm containers
+	constexpr bool
+	isEmpty() const { return empty(); }
+
+	constexpr bool
+	isFull() const { return size_ == N; }
+
+	constexpr size_type
+	getSize() const { return size_; }
+
+	static constexpr size_type
+	getMaxSize() { return N; }
+
+private:
+	// Fibonacci hashing of the upper bits, since the hash of integral keys is
+	// the key itself and consecutive keys would otherwise form one cluster.
+	constexpr std::size_t
+	home(const Key& key) const
+	{
+		const std::size_t value = hash(key);
+		uint32_t folded = static_cast<uint32_t>(value);
+		if constexpr (sizeof(std::size_t) > sizeof(uint32_t)) {
+			folded ^= static_cast<uint32_t>(static_cast<uint64_t>(value) >> 32);
+		}
+		const uint32_t product = folded * uint32_t(0x9E3779B9);
+		return static_cast<std::size_t>(product >> Shift);
+	}
+
+	// Slot of the key or the empty slot where it would be inserted. The table
+	// always contains an empty slot, so the loop terminates.
+	constexpr std::size_t
+	probe(const Key& key) const
+	{
+		std::size_t index = home(key);
+		while (used[index] and not equal(slots[index].first, key)) {
+			index = (index + 1) & Mask;
+		}
+		return index;
+	}
+
+	// Index of the first used slot starting at index, or Slots
+	constexpr std::size_t
+	next(std::size_t index) const
+	{
+		while (index < Slots and not used[index]) {
+			index++;
+		}
+		return index;
+	}
+
+	constexpr void
+	eraseSlot(std::size_t hole)
+	{
+		for (std::size_t index = (hole + 1) & Mask; used[index]; index = (index + 1) & Mask)
+		{
+			// The element may fill the hole if the hole is between its home
+			// slot and its current slot.
+			const std::size_t distance = (index - home(slots[index].first)) & Mask;
+			if (distance >= ((index - hole) & Mask))
+			{
+				slots[hole] = std::move(slots[index]);
+				hole = index;
+			}
+		}
+		slots[hole] = value_type();
+		used[hole] = false;
+		size_--;
+	}
+
+	static constexpr void
+	capacityExceeded()
+	{
+		if (std::is_constant_evaluated()) {
+			detail::flat_map_capacity_exceeded();
+		} else {
+			modm_assert(false, "flat_map.full", "The capacity of the static_flat_map is exceeded!");
+		}
+	}
+
+	std::array<value_type, Slots> slots{};
+	std::array<bool, Slots> used{};
+	size_type size_{0};
+	[[no_unique_address]] Hash hash{};
+	[[no_unique_address]] KeyEqual equal{};
+};
+
+}	// namespace modm
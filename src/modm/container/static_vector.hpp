@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "inline_vector.hpp"
+
+namespace modm
+{
+
+/**
+ * Vector with a fixed capacity and inline storage.
+ *
+ * The elements are stored inside the object, so a `static_vector` never
+ * allocates memory and can be placed in static memory or on the stack. Apart
+ * from the fixed capacity it has the interface of `std::vector`, including
+ * move semantics and random access iterators, and the common interface of the
+ * modm containers.
+ *
+ * Appending an element to a full vector with `push_back()` or
+ * `emplace_back()` is a failed assertion, while `append()` returns `false`.
+ *
+ * \code
+ * modm::static_vector<uint16_t, 8> samples{1, 2, 3};
+ * samples.push_back(4);
+ * for (uint16_t sample : samples) { ... }
+ * \endcode
+ *
+ * \tparam	T	Type of the elements
+ * \tparam	N	Capacity
+ *
+ * \see		modm::small_vector
+ * \ingroup	modm_container
+ */
+template<typename T, std::size_t N>
+using static_vector = detail::inline_vector<T, N, void>;
+
+}	// namespace modm
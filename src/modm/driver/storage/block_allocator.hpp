@@ -71,6 +71,14 @@ public:
 	std::size_t
 	getAvailableSize() const;
 
+	/// @return the size of the largest free area in bytes.
+	std::size_t
+	getLargestAvailableSize() const;
+
+	/// @return the usable size of memory previously acquired by allocate().
+	std::size_t
+	getSize(const void *ptr) const;
+
 private:
 	// Align the pointer to a multiple of MODM_ALIGNMENT
 	T *
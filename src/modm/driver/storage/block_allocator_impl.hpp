@@ -206,6 +206,40 @@ modm::BlockAllocator<T, BLOCK_SIZE>::getAvailableSize() const
 	return size;
 }
 
+// ----------------------------------------------------------------------------
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getLargestAvailableSize() const
+{
+	T *p = start;
+	std::size_t size = 0;
+
+	do {
+		SignedType slots = *p;
+
+		if (slots < 0)
+		{
+			// slots < 0 => free slots
+			slots = -slots;
+			size = std::max<std::size_t>(size, slots * BLOCK_SIZE * sizeof(T));
+		}
+
+		p += slots * BLOCK_SIZE;
+	}
+	while (p < end);
+
+	return size;
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getSize(const void *ptr) const
+{
+	const T *p = (const T *) ptr;
+	// the 4 bytes for the management are not usable
+	return *(p - 1) * BLOCK_SIZE * sizeof(T) - 4;
+}
+
 // ----------------------------------------------------------------------------
 template<typename T, unsigned int BLOCK_SIZE >
 T *
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_CACHE_HPP
+#define MODM_BLOCK_DEVICE_CACHE_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/processing/resumable.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace modm
+{
+
+/**
+ * \brief	Write-back cache in front of another block device.
+ *
+ * The cache holds `Lines` lines of `LineSize` bytes, which are aligned to
+ * their size. Reads load the whole line from the block device, so that
+ * following reads of neighboring data are served from RAM. Writes only modify
+ * the cached line, which is erased and programmed on the block device as one
+ * unit when the line is evicted or `flush()` is called. Many small records
+ * written into the same erase block therefore cost one erase and one program
+ * of the block device instead of one each.
+ *
+ * The least recently used line is evicted when a new line is needed. Reads of
+ * complete lines which are not cached bypass the cache.
+ *
+ * The cache accepts reads and writes of any size at any address. Since the
+ * data is erased when the line is written back, `program()` behaves like
+ * `write()`. `erase()` is forwarded to the block device and discards the
+ * cached data of the erased blocks.
+ *
+ * @warning	Modified data is lost if `flush()` or `deinitialize()` is not
+ * 			called before the power is removed.
+ *
+ * \tparam	BackingDevice	The cached block device
+ * \tparam	Lines			Number of cache lines
+ * \tparam	LineSize		Size of a line in bytes, a multiple of the erase
+ * 							block size of the block device
+ *
+ * \ingroup	modm_driver_block_device_cache
+ */
+template <typename BackingDevice, std::size_t Lines = 4, std::size_t LineSize = BackingDevice::BlockSizeErase>
+class BdCache : public modm::BlockDevice, protected NestedResumable<3>
+{
+	static_assert(Lines > 0, "The cache needs at least one line!");
+	static_assert(LineSize % BackingDevice::BlockSizeErase == 0 and
+				  LineSize % BackingDevice::BlockSizeWrite == 0 and
+				  LineSize % BackingDevice::BlockSizeRead == 0,
+				  "The line size must be a multiple of the block sizes of the block device!");
+	static_assert(BackingDevice::DeviceSize % LineSize == 0,
+				  "The device size must be a multiple of the line size!");
+
+public:
+	/// Initializes the storage hardware and empties the cache
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Writes back all modified lines and deinitializes the storage hardware
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data through the cache
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Write data into the cache, same as `write()`
+	 *
+	 *  @param buffer	Buffer of data to write
+	 *  @param address	Address to begin writing to
+	 *  @param size		Size to write in bytes
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks of the block device
+	 *
+	 *  The cached data of the erased blocks is discarded.
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of erase block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Write data into the cache
+	 *
+	 *  The lines are erased and programmed when they are written back.
+	 *
+	 *  @param buffer	Buffer of data to write
+	 *  @param address	Address to begin writing to
+	 *  @param size		Size to write in bytes
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Write back all modified lines
+	 *
+	 *  The lines stay in the cache.
+	 *
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	flush();
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 1;
+	static constexpr bd_size_t BlockSizeErase = BackingDevice::BlockSizeErase;
+	static constexpr bd_size_t DeviceSize = BackingDevice::DeviceSize;
+
+public:
+	/** Direct access to the cached block device
+	*
+	*  @return	BackingDevice
+	*/
+	inline BackingDevice& getBlockDevice() { return blockDevice; }
+
+private:
+	static constexpr std::size_t NoLine = Lines;
+
+	bool
+	isValid(bd_address_t address, bd_size_t size) const
+	{ return size != 0 and size <= DeviceSize and address <= DeviceSize - size; }
+
+	/// Index of the line holding the address or NoLine
+	std::size_t
+	find(bd_address_t lineAddress) const;
+
+	/// Makes the line of `lineAddress` available in `lineIndex`, optionally
+	/// with the data of the block device
+	modm::ResumableResult<bool>
+	fetch(bd_address_t lineAddress, bool load);
+
+	modm::ResumableResult<bool>
+	writeBack(std::size_t index);
+
+	/// Splits the remaining request at the next line boundary
+	void
+	nextChunk();
+
+	struct Line
+	{
+		bd_address_t address;
+		uint32_t lastUse;
+		bool valid;
+		bool dirty;
+	};
+
+	BackingDevice blockDevice;
+
+	Line lines[Lines]{};
+	uint8_t data[Lines][LineSize];
+	uint32_t useCounter = 0;
+
+	// State of the running operation
+	uint8_t* readBuffer;
+	const uint8_t* writeBuffer;
+	bd_address_t current;
+	bd_size_t remaining;
+	bd_address_t lineAddress;
+	bd_size_t lineOffset;
+	bd_size_t chunkSize;
+	std::size_t lineIndex;
+	std::size_t victim;
+	bool result;
+};
+
+}
+#include "block_device_cache_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_CACHE_HPP
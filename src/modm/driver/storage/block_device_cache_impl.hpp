@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_CACHE_HPP
+	#error	"Don't include this file directly, use 'block_device_cache.hpp' instead!"
+#endif
+#include <algorithm>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::initialize()
+{
+	RF_BEGIN();
+
+	for (Line& line : lines) {
+		line = Line{};
+	}
+
+	RF_END_RETURN_CALL(blockDevice.initialize());
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::deinitialize()
+{
+	RF_BEGIN();
+
+	result = RF_CALL(flush());
+	if (not RF_CALL(blockDevice.deinitialize())) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN(result);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if (not isValid(address, size)) {
+		RF_RETURN(false);
+	}
+
+	readBuffer = buffer;
+	current = address;
+	remaining = size;
+	while (remaining > 0)
+	{
+		nextChunk();
+		lineIndex = find(lineAddress);
+		if (lineIndex == NoLine and chunkSize == LineSize)
+		{
+			// complete lines are read directly and would only evict other lines
+			if (not RF_CALL(blockDevice.read(readBuffer, lineAddress, LineSize))) {
+				RF_RETURN(false);
+			}
+		}
+		else
+		{
+			if (lineIndex == NoLine)
+			{
+				if (not RF_CALL(fetch(lineAddress, true))) {
+					RF_RETURN(false);
+				}
+			}
+			std::memcpy(readBuffer, data[lineIndex] + lineOffset, chunkSize);
+			lines[lineIndex].lastUse = ++useCounter;
+		}
+		readBuffer += chunkSize;
+		current += chunkSize;
+		remaining -= chunkSize;
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	return write(buffer, address, size);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if (not isValid(address, size) or (address % BlockSizeErase != 0) or (size % BlockSizeErase != 0)) {
+		RF_RETURN(false);
+	}
+
+	for (lineIndex = 0; lineIndex < Lines; lineIndex++)
+	{
+		if (not lines[lineIndex].valid or
+			lines[lineIndex].address + LineSize <= address or
+			lines[lineIndex].address >= address + size) {
+			continue;
+		}
+		// a partially erased line keeps the modified data outside of the erased blocks
+		if (lines[lineIndex].dirty and
+			(lines[lineIndex].address < address or
+			 lines[lineIndex].address + LineSize > address + size))
+		{
+			if (not RF_CALL(writeBack(lineIndex))) {
+				RF_RETURN(false);
+			}
+		}
+		lines[lineIndex].valid = false;
+		lines[lineIndex].dirty = false;
+	}
+
+	RF_END_RETURN_CALL(blockDevice.erase(address, size));
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if (not isValid(address, size)) {
+		RF_RETURN(false);
+	}
+
+	writeBuffer = buffer;
+	current = address;
+	remaining = size;
+	while (remaining > 0)
+	{
+		nextChunk();
+		lineIndex = find(lineAddress);
+		if (lineIndex == NoLine)
+		{
+			// a completely overwritten line does not need to be loaded
+			if (not RF_CALL(fetch(lineAddress, chunkSize != LineSize))) {
+				RF_RETURN(false);
+			}
+		}
+		std::memcpy(data[lineIndex] + lineOffset, writeBuffer, chunkSize);
+		lines[lineIndex].lastUse = ++useCounter;
+		lines[lineIndex].dirty = true;
+
+		writeBuffer += chunkSize;
+		current += chunkSize;
+		remaining -= chunkSize;
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::flush()
+{
+	RF_BEGIN();
+
+	for (victim = 0; victim < Lines; victim++)
+	{
+		if (lines[victim].dirty)
+		{
+			if (not RF_CALL(writeBack(victim))) {
+				RF_RETURN(false);
+			}
+		}
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+std::size_t
+modm::BdCache<BackingDevice, Lines, LineSize>::find(bd_address_t address) const
+{
+	for (std::size_t index = 0; index < Lines; index++)
+	{
+		if (lines[index].valid and lines[index].address == address) {
+			return index;
+		}
+	}
+	return NoLine;
+}
+
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::fetch(bd_address_t address, bool load)
+{
+	RF_BEGIN();
+
+	// least recently used line, unused lines first
+	victim = 0;
+	for (std::size_t index = 1; index < Lines and lines[victim].valid; index++)
+	{
+		if (not lines[index].valid or lines[index].lastUse < lines[victim].lastUse) {
+			victim = index;
+		}
+	}
+
+	if (lines[victim].dirty)
+	{
+		if (not RF_CALL(writeBack(victim))) {
+			RF_RETURN(false);
+		}
+	}
+	lines[victim].valid = false;
+
+	if (load)
+	{
+		if (not RF_CALL(blockDevice.read(data[victim], address, LineSize))) {
+			RF_RETURN(false);
+		}
+	}
+
+	lines[victim].address = address;
+	lines[victim].valid = true;
+	lines[victim].dirty = false;
+	lineIndex = victim;
+
+	RF_END_RETURN(true);
+}
+
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<BackingDevice, Lines, LineSize>::writeBack(std::size_t index)
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(blockDevice.write(data[index], lines[index].address, LineSize))) {
+		RF_RETURN(false);
+	}
+	lines[index].dirty = false;
+
+	RF_END_RETURN(true);
+}
+
+template <typename BackingDevice, std::size_t Lines, std::size_t LineSize>
+void
+modm::BdCache<BackingDevice, Lines, LineSize>::nextChunk()
+{
+	lineAddress = current - (current % LineSize);
+	lineOffset = current - lineAddress;
+	chunkSize = std::min<bd_size_t>(remaining, LineSize - lineOffset);
+}
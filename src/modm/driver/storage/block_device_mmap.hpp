@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_MMAP_HPP
+#define MODM_BLOCK_DEVICE_MMAP_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+
+#include <modm/processing/resumable.hpp>
+
+#include <cstdint>
+#include <span>
+
+namespace modm
+{
+
+/// When the memory mapped file is written back to the disk
+/// \ingroup	modm_driver_block_device_mmap
+enum class
+BdMmapSync : uint8_t
+{
+	/// By the operating system whenever it likes, at the latest on process exit
+	None,
+	/// Started after every program and erase, without waiting
+	Asynchronous,
+	/// After every program and erase, waiting until the data is on the disk
+	Synchronous,
+};
+
+/**
+ * \brief	Block device using a memory mapped file
+ *
+ * Persistent like `modm::BdFile`, but the file is mapped into memory, so that
+ * reading, programming and erasing are plain memory copies without any
+ * system call. This makes it suitable for large images in tests and
+ * simulations. The data can also be accessed directly with `getData()`.
+ *
+ * An empty file is extended to `DeviceSize` and erased, a file of any other
+ * size is rejected. Erased memory reads as 0xFF, like NOR flash.
+ *
+ * \tparam	Filename	Class with a `static constexpr const char* name`
+ * \tparam	DeviceSize	The size of the block device
+ * \tparam	Sync		When the data is written back to the file
+ *
+ * \ingroup	modm_driver_block_device_mmap
+ */
+template <class Filename, size_t DeviceSize_, BdMmapSync Sync = BdMmapSync::None>
+class BdMmap : public modm::BlockDevice, protected modm::NestedResumable<3>
+{
+public:
+	BdMmap() = default;
+	BdMmap(const BdMmap&) = delete;
+	BdMmap& operator=(const BdMmap&) = delete;
+
+	~BdMmap();
+
+	/// Opens and maps the file, which is created if it does not exist
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Writes all data back to the file and unmaps it
+	/// @return	`false` if writing back or unmapping failed
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  Any block has to be erased prior to being programmed
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  Erased blocks read as 0xFF
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks after erasing them
+	*
+	*  The blocks are erased prior to being programmed
+	*
+	*  @param buffer	Buffer of data to write to blocks
+	*  @param address	Address of first block to begin writing to
+	*  @param size		Size to write in bytes (multiple of read block size)
+	*  @return			True on success
+	*/
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/// Writes all modified data back to the file and waits until it is done
+	bool
+	sync();
+
+	/**
+	 * Direct access to the mapped memory, empty if the device is not
+	 * initialized.
+	 *
+	 * Modifications through the span bypass the sync policy, call `sync()`
+	 * to write them back.
+	 */
+	std::span<uint8_t>
+	getData()
+	{ return {memory, memory ? DeviceSize : 0}; }
+
+	std::span<const uint8_t>
+	getData() const
+	{ return {memory, memory ? DeviceSize : 0}; }
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 1;
+	static constexpr bd_size_t BlockSizeErase = 1;
+	static constexpr bd_size_t DeviceSize = DeviceSize_;
+
+private:
+	bool
+	isValid(bd_address_t address, bd_size_t size) const
+	{ return memory and size != 0 and size <= DeviceSize and address <= DeviceSize - size; }
+
+	/// Writes the range back according to the sync policy
+	/// @return	`false` if `msync()` failed
+	bool
+	synchronize(bd_address_t address, bd_size_t size);
+
+	uint8_t* memory = nullptr;
+};
+
+}
+#include "block_device_mmap_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_MMAP_HPP
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_MMAP_HPP
+	#error	"Don't include this file directly, use 'block_device_mmap.hpp' instead!"
+#endif
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+modm::BdMmap<Filename, DeviceSize, Sync>::~BdMmap()
+{
+	if (memory) {
+		munmap(memory, DeviceSize);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+modm::ResumableResult<bool>
+modm::BdMmap<Filename, DeviceSize, Sync>::initialize()
+{
+	RF_BEGIN();
+	if (memory) {
+		RF_RETURN(true);
+	}
+	{
+		const int fd = ::open(Filename::name, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+		if (fd == -1) {
+			RF_RETURN(false);
+		}
+		struct stat status;
+		bool valid = (fstat(fd, &status) == 0);
+		const bool created = valid and status.st_size == 0;
+		if (created) {
+			// create empty file with size of DeviceSize
+			valid = (ftruncate(fd, DeviceSize) == 0);
+		}
+		else if (valid) {
+			valid = (size_t(status.st_size) == DeviceSize);
+		}
+		if (valid)
+		{
+			void* const mapping = mmap(nullptr, DeviceSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (mapping != MAP_FAILED) {
+				memory = static_cast<uint8_t*>(mapping);
+			}
+		}
+		if (memory and created)
+		{
+			// the file is extended with zeros, but a new device is erased
+			std::memset(memory, 0xFF, DeviceSize);
+			if (not synchronize(0, DeviceSize))
+			{
+				munmap(memory, DeviceSize);
+				memory = nullptr;
+			}
+		}
+		// the mapping stays valid without the file descriptor
+		::close(fd);
+	}
+	RF_END_RETURN(memory != nullptr);
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+modm::ResumableResult<bool>
+modm::BdMmap<Filename, DeviceSize, Sync>::deinitialize()
+{
+	RF_BEGIN();
+	if (memory)
+	{
+		bool success = true;
+		if constexpr (Sync != BdMmapSync::None) {
+			success = sync();
+		}
+		success = (munmap(memory, DeviceSize) == 0) and success;
+		memory = nullptr;
+		RF_RETURN(success);
+	}
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+modm::ResumableResult<bool>
+modm::BdMmap<Filename, DeviceSize, Sync>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if (not isValid(address, size)) {
+		RF_RETURN(false);
+	}
+
+	std::memcpy(buffer, memory + address, size);
+
+	RF_END_RETURN(true);
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+modm::ResumableResult<bool>
+modm::BdMmap<Filename, DeviceSize, Sync>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if (not isValid(address, size)) {
+		RF_RETURN(false);
+	}
+
+	std::memcpy(memory + address, buffer, size);
+
+	RF_END_RETURN(synchronize(address, size));
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+modm::ResumableResult<bool>
+modm::BdMmap<Filename, DeviceSize, Sync>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if (not isValid(address, size)) {
+		RF_RETURN(false);
+	}
+
+	std::memset(memory + address, 0xFF, size);
+
+	RF_END_RETURN(synchronize(address, size));
+}
+
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+modm::ResumableResult<bool>
+modm::BdMmap<Filename, DeviceSize, Sync>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if (not isValid(address, size)) {
+		RF_RETURN(false);
+	}
+
+	// programming overwrites all erased bytes anyway
+	std::memcpy(memory + address, buffer, size);
+
+	RF_END_RETURN(synchronize(address, size));
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+bool
+modm::BdMmap<Filename, DeviceSize, Sync>::sync()
+{
+	return memory and msync(memory, DeviceSize, MS_SYNC) == 0;
+}
+
+template <class Filename, size_t DeviceSize, modm::BdMmapSync Sync>
+bool
+modm::BdMmap<Filename, DeviceSize, Sync>::synchronize(bd_address_t address, bd_size_t size)
+{
+	if constexpr (Sync != BdMmapSync::None)
+	{
+		// msync() requires a page aligned address
+		static const bd_address_t pageMask = ~bd_address_t(sysconf(_SC_PAGESIZE) - 1);
+		const bd_address_t start = address & pageMask;
+		return msync(memory + start, address + size - start,
+					 (Sync == BdMmapSync::Synchronous) ? MS_SYNC : MS_ASYNC) == 0;
+	}
+	else {
+		(void) address; (void) size;
+		return true;
+	}
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_KEY_VALUE_STORE_HPP
+#define MODM_KEY_VALUE_STORE_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/processing/resumable.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace modm
+{
+
+/**
+ * \brief	Log-structured key/value store on a block device
+ *
+ * The block device is split into sectors of `SectorSize` bytes, which are
+ * used as a circular log. Every write appends a record with the key, the
+ * value and two CRCs to the newest sector, so updating a value programs only
+ * the size of the record and never rewrites a sector. A RAM index maps each key
+ * to its newest record, so that reading a value is a single read of the block
+ * device. The index is rebuilt by `mount()` from the records on the device.
+ *
+ * When the newest sector is full, the next free sector is erased and continues
+ * the log. If no other sector is free then, the still valid records of the
+ * oldest sector are copied into the new sector first and the oldest sector
+ * becomes free. Since the sectors are used in order, the erases are spread
+ * evenly over the device.
+ *
+ * This work can be done ahead of time by `compact()`, which can be called from
+ * a fiber or protothread while the application is idle. It compacts the oldest
+ * sector into the newest one while there is room and erases the next free
+ * sector. Writes that need the space do the remaining work themselves, so
+ * calling `compact()` is optional.
+ *
+ * A record only becomes valid once it is completely programmed: the header is
+ * written first and contains the CRC of the value, so a record interrupted by
+ * a power loss is ignored by the next `mount()`, which returns the previous
+ * value of the key. Sectors are retired by programming zeros over their header
+ * before they are erased, which requires a block device that allows clearing
+ * already programmed bits, like NOR flash or `modm::BdHeap` and `modm::BdFile`.
+ *
+ * The functions must not be called concurrently, this includes `compact()`.
+ *
+ * \tparam	BackingDevice	The block device holding the log, its read block
+ * 							size must be one byte
+ * \tparam	MaxKeys			Maximum number of keys in the RAM index
+ * \tparam	SectorSize		Size of a sector in bytes, a multiple of the erase
+ * 							block size of the block device
+ *
+ * \ingroup	modm_driver_key_value_store
+ */
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize = BackingDevice::BlockSizeErase>
+class KeyValueStore : protected NestedResumable<4>
+{
+	static_assert(BackingDevice::BlockSizeRead == 1,
+				  "The block device must allow reading single bytes!");
+	static_assert(SectorSize % BackingDevice::BlockSizeErase == 0 and
+				  SectorSize % BackingDevice::BlockSizeWrite == 0,
+				  "The sector size must be a multiple of the block sizes of the block device!");
+	static_assert(BackingDevice::DeviceSize / SectorSize >= 2,
+				  "The block device must hold at least two sectors!");
+	static_assert(MaxKeys > 0 and MaxKeys < 0x8000, "The index must hold 1 to 32767 keys!");
+
+public:
+	using Key = uint16_t;
+
+	/// Reserved key, which cannot be stored
+	static constexpr Key InvalidKey = 0xFFFF;
+
+public:
+	/** Initializes the block device and rebuilds the index from the log
+	 *
+	 *  A block device without any valid sector is formatted.
+	 *
+	 *  @return	True on success
+	 */
+	modm::ResumableResult<bool>
+	mount();
+
+	/** Removes all keys by retiring all sectors and starting a new log
+	 *
+	 *  @return	True on success
+	 */
+	modm::ResumableResult<bool>
+	format();
+
+	/** Reads the value of a key
+	 *
+	 *  @param key		The key to read
+	 *  @param buffer	Buffer to read the value into
+	 *  @param size		Size of the buffer, at least `getSize(key)`
+	 *  @return			True if the key exists and the value was read
+	 */
+	modm::ResumableResult<bool>
+	read(Key key, uint8_t* buffer, std::size_t size);
+
+	/** Stores the value of a key
+	 *
+	 *  The previous value stays valid until the new record is completely
+	 *  programmed.
+	 *
+	 *  @param key		The key to write, must not be `InvalidKey`
+	 *  @param buffer	The value to store
+	 *  @param size		Size of the value, at most `MaxValueSize`
+	 *  @return			True on success, false if the store or the index is full
+	 */
+	modm::ResumableResult<bool>
+	write(Key key, const uint8_t* buffer, std::size_t size);
+
+	/** Removes a key
+	 *
+	 *  @param key		The key to remove
+	 *  @return			True on success, also if the key did not exist
+	 */
+	modm::ResumableResult<bool>
+	remove(Key key);
+
+	/** Compacts the oldest sector if the next rotation would have to and
+	 *  erases the next free sector
+	 *
+	 *  Does nothing if there is no pending work, call this when idle.
+	 *
+	 *  @return	True on success
+	 */
+	modm::ResumableResult<bool>
+	compact();
+
+	/// @return true if the key exists
+	bool
+	contains(Key key) const
+	{ return find(key) != NoSlot; }
+
+	/// @return the size of the value of the key or zero if it does not exist
+	std::size_t
+	getSize(Key key) const;
+
+	/// @return the number of stored keys
+	std::size_t
+	getCount() const
+	{ return count; }
+
+	/// @return true if the oldest sector has to be compacted before the next rotation
+	bool
+	isCompactionPending() const
+	{ return used >= 2 and used + 1 >= Sectors; }
+
+public:
+	/** Direct access to the block device
+	*
+	*  @return	BackingDevice
+	*/
+	inline BackingDevice& getBlockDevice() { return blockDevice; }
+
+private:
+	using bd_address_t = modm::BlockDevice::bd_address_t;
+	using bd_size_t = modm::BlockDevice::bd_size_t;
+
+	static constexpr std::size_t Sectors = BackingDevice::DeviceSize / SectorSize;
+	static constexpr bd_size_t Alignment = BackingDevice::BlockSizeWrite;
+	/// Staging buffer for programming, at least 32 bytes and a multiple of the write block size
+	static constexpr bd_size_t BufferSize = Alignment * ((32 + Alignment - 1) / Alignment);
+
+	static constexpr bd_size_t
+	align(bd_size_t size)
+	{ return (size + Alignment - 1) / Alignment * Alignment; }
+
+	/// magic (4), sequence (4), crc (4)
+	static constexpr bd_size_t SectorHeaderSize = 12;
+	/// key (2), length (2), value crc (4), header crc (4)
+	static constexpr bd_size_t RecordHeaderSize = 12;
+	static constexpr bd_size_t FirstRecord = align(SectorHeaderSize);
+	static constexpr uint32_t Magic = 0x4D4B5653;
+	static constexpr uint16_t Tombstone = 0xFFFF;
+
+	static constexpr bd_size_t
+	recordSize(std::size_t length)
+	{ return align(RecordHeaderSize + (length == Tombstone ? 0 : length)); }
+
+	static_assert(FirstRecord <= BufferSize);
+
+public:
+	/// Largest value that fits into a sector
+	static constexpr std::size_t MaxValueSize = std::min<std::size_t>(
+			(SectorSize - FirstRecord) / Alignment * Alignment - RecordHeaderSize, Tombstone - 1);
+
+private:
+	/// Open addressing with linear probing at a load factor of at most 50%
+	static constexpr std::size_t Slots = std::bit_ceil(2 * MaxKeys);
+	static constexpr std::size_t NoSlot = Slots;
+
+	struct Entry
+	{
+		bd_address_t address;	///< address of the record
+		uint16_t length;
+		Key key;
+	};
+
+	static std::size_t
+	hash(Key key)
+	{ return uint32_t(uint32_t(key) * 2654435761u) >> (32 - std::countr_zero(Slots)); }
+
+	std::size_t
+	find(Key key) const;
+
+	/// Points the key to a record and updates the live bytes of the sectors
+	bool
+	insert(Key key, bd_address_t address, uint16_t length);
+
+	void
+	removeEntry(Key key);
+
+	/// Resets the index and the sectors
+	void
+	clear();
+
+	static bd_address_t
+	sectorAddress(std::size_t sector)
+	{ return sector * SectorSize; }
+
+	static std::size_t
+	next(std::size_t sector)
+	{ return (sector + 1) % Sectors; }
+
+	std::size_t
+	oldest() const
+	{ return (head + Sectors + 1 - used) % Sectors; }
+
+	bd_size_t
+	getFree() const
+	{ return sectorAddress(head) + SectorSize - position; }
+
+	/// @return the sequence of the sector header in the buffer or zero if it is invalid
+	uint32_t
+	parseSectorHeader() const;
+
+	/// CRC of the record header, which depends on the sequence of its sector
+	/// to reject records left over from a previous use of the sector
+	static uint32_t
+	headerCrc(uint32_t sequence, const uint8_t* header);
+
+	/// Appends a record to the head sector, the value is either copied from
+	/// RAM or from another address of the block device
+	modm::ResumableResult<bool>
+	append(Key key, uint16_t length, uint32_t crc, const uint8_t* buffer, bd_address_t source);
+
+	/// Makes room for a record of `size` bytes in the head sector
+	modm::ResumableResult<bool>
+	allocate(bd_size_t size);
+
+	/// Continues the log in the next sector
+	modm::ResumableResult<bool>
+	rotate();
+
+	/// Copies the valid records of the oldest sector into the head sector
+	/// and retires the oldest sector
+	modm::ResumableResult<bool>
+	collect();
+
+	/// Invalidates the header of a sector
+	modm::ResumableResult<bool>
+	retire(std::size_t sector);
+
+	/// Erases a sector and makes sure it reads as 0xFF
+	modm::ResumableResult<bool>
+	prepare(std::size_t sector);
+
+	/// Reads and checks the record at `scan`
+	modm::ResumableResult<bool>
+	verify(uint32_t sequence);
+
+	enum class
+	Scan : uint8_t
+	{
+		Valid,
+		Torn,		///< the value does not match its CRC
+		Garbage,	///< the header is damaged
+		Blank,		///< end of the log in this sector
+	};
+
+	BackingDevice blockDevice;
+
+	Entry index[Slots];
+	std::size_t count = 0;
+
+	/// Sequence number of the sectors, zero for free sectors
+	uint32_t sequences[Sectors];
+	/// Bytes of the records which are still referenced by the index
+	bd_size_t live[Sectors];
+	uint32_t lastSequence = 0;
+	std::size_t head = 0;
+	std::size_t used = 0;
+	bd_address_t position;	///< next free byte in the head sector
+	/// The next sector has been prepared and not been used since
+	bool erased = false;
+
+	uint8_t buffer[BufferSize];
+
+	// State of the running operation
+	const uint8_t* writeBuffer;
+	bd_address_t copySource;
+	bd_address_t target;
+	bd_address_t scan;
+	bd_address_t end;
+	bd_size_t remaining;
+	bd_size_t fill;
+	bd_size_t chunk;
+	std::size_t sector;
+	std::size_t victim;
+	std::size_t slot;
+	std::size_t attempt;
+	uint32_t crc;
+	uint32_t valueCrc;
+	uint32_t copyCrc;
+	uint32_t recordCrc;
+	Key recordKey;
+	Key appendKey;
+	uint16_t recordLength;
+	uint16_t appendLength;
+	Scan state;
+	bool result;
+};
+
+}
+#include "key_value_store_impl.hpp"
+
+#endif // MODM_KEY_VALUE_STORE_HPP
@@ -0,0 +1,612 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_KEY_VALUE_STORE_HPP
+	#error	"Don't include this file directly, use 'key_value_store.hpp' instead!"
+#endif
+#include <modm/math/utils/crc.hpp>
+#include <algorithm>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::mount()
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(blockDevice.initialize())) {
+		RF_RETURN(false);
+	}
+	clear();
+
+	for (sector = 0; sector < Sectors; sector++)
+	{
+		if (not RF_CALL(blockDevice.read(buffer, sectorAddress(sector), SectorHeaderSize))) {
+			RF_RETURN(false);
+		}
+		sequences[sector] = parseSectorHeader();
+		if (sequences[sector] > sequences[head]) {
+			head = sector;
+		}
+	}
+	if (sequences[head] == 0) {
+		RF_RETURN_CALL(format());
+	}
+	lastSequence = sequences[head];
+
+	// the log continues backwards from the newest sector while the sequence decreases
+	used = 1;
+	for (sector = head; used < Sectors; used++)
+	{
+		const std::size_t previous = (sector + Sectors - 1) % Sectors;
+		if (sequences[previous] == 0 or sequences[previous] >= sequences[sector]) {
+			break;
+		}
+		sector = previous;
+	}
+	if (used == Sectors)
+	{
+		// The compaction after the last rotation was interrupted, the newest
+		// sector only contains copies of the records in the oldest sector.
+		sequences[head] = 0;
+		head = (head + Sectors - 1) % Sectors;
+		used--;
+	}
+	for (sector = 0; sector < Sectors; sector++)
+	{
+		// valid sectors outside of the log are left over from an interrupted format
+		if ((sector + Sectors - oldest()) % Sectors >= used) {
+			sequences[sector] = 0;
+		}
+	}
+
+	// replay the records from the oldest to the newest
+	for (sector = oldest(); ; sector = next(sector))
+	{
+		scan = sectorAddress(sector) + FirstRecord;
+		end = sectorAddress(sector) + SectorSize;
+		while (scan + RecordHeaderSize <= end)
+		{
+			if (not RF_CALL(verify(sequences[sector]))) {
+				RF_RETURN(false);
+			}
+			if (state == Scan::Blank) {
+				break;
+			}
+			if (state == Scan::Valid)
+			{
+				if (recordLength == Tombstone) {
+					removeEntry(recordKey);
+				}
+				else if (not insert(recordKey, scan, recordLength)) {
+					RF_RETURN(false);
+				}
+			}
+			// a record interrupted by a power loss is skipped. Only the first
+			// program operation can be affected if its header is damaged.
+			scan += (state == Scan::Garbage) ? BufferSize : recordSize(recordLength);
+		}
+		if (sector == head) {
+			position = std::min(scan, end);
+			break;
+		}
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::format()
+{
+	RF_BEGIN();
+
+	for (sector = 0; sector < Sectors; sector++)
+	{
+		if (not RF_CALL(blockDevice.read(buffer, sectorAddress(sector), SectorHeaderSize))) {
+			RF_RETURN(false);
+		}
+		if (parseSectorHeader() != 0)
+		{
+			if (not RF_CALL(retire(sector))) {
+				RF_RETURN(false);
+			}
+		}
+	}
+
+	clear();
+	head = Sectors - 1;
+
+	RF_END_RETURN_CALL(rotate());
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::read(Key key, uint8_t* buffer, std::size_t size)
+{
+	RF_BEGIN();
+
+	slot = find(key);
+	if (slot == NoSlot or size < index[slot].length) {
+		RF_RETURN(false);
+	}
+	if (index[slot].length == 0) {
+		RF_RETURN(true);
+	}
+
+	RF_END_RETURN_CALL(blockDevice.read(buffer, index[slot].address + RecordHeaderSize, index[slot].length));
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::write(Key key, const uint8_t* buffer, std::size_t size)
+{
+	RF_BEGIN();
+
+	if (used == 0 or key == InvalidKey or size > MaxValueSize or
+		(count >= MaxKeys and not contains(key))) {
+		RF_RETURN(false);
+	}
+	valueCrc = modm::math::crc32(buffer, size);
+
+	if (not RF_CALL(allocate(recordSize(size)))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(append(key, size, valueCrc, buffer, 0));
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::remove(Key key)
+{
+	RF_BEGIN();
+
+	if (used == 0) {
+		RF_RETURN(false);
+	}
+	if (not contains(key)) {
+		RF_RETURN(true);
+	}
+
+	if (not RF_CALL(allocate(recordSize(Tombstone)))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(append(key, Tombstone, ~modm::math::crc32_init, nullptr, 0));
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::compact()
+{
+	RF_BEGIN();
+
+	if (used == 0) {
+		RF_RETURN(false);
+	}
+	if (isCompactionPending() and getFree() >= live[oldest()])
+	{
+		if (not RF_CALL(collect())) {
+			RF_RETURN(false);
+		}
+	}
+	if (not erased and used < Sectors)
+	{
+		if (not RF_CALL(prepare(next(head)))) {
+			RF_RETURN(false);
+		}
+		erased = true;
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+std::size_t
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::getSize(Key key) const
+{
+	const std::size_t entry = find(key);
+	return (entry == NoSlot) ? 0 : index[entry].length;
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+std::size_t
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::find(Key key) const
+{
+	for (std::size_t entry = hash(key);; entry = (entry + 1) % Slots)
+	{
+		if (index[entry].key == key) {
+			return entry;
+		}
+		if (index[entry].key == InvalidKey) {
+			return NoSlot;
+		}
+	}
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+bool
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::insert(Key key, bd_address_t address, uint16_t length)
+{
+	std::size_t entry = hash(key);
+	while (index[entry].key != key and index[entry].key != InvalidKey) {
+		entry = (entry + 1) % Slots;
+	}
+	if (index[entry].key == key) {
+		live[index[entry].address / SectorSize] -= recordSize(index[entry].length);
+	}
+	else if (count >= MaxKeys) {
+		return false;
+	}
+	else {
+		count++;
+	}
+	index[entry] = Entry{address, length, key};
+	live[address / SectorSize] += recordSize(length);
+	return true;
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+void
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::removeEntry(Key key)
+{
+	std::size_t entry = find(key);
+	if (entry == NoSlot) {
+		return;
+	}
+	live[index[entry].address / SectorSize] -= recordSize(index[entry].length);
+	count--;
+
+	// shift the following entries back, so that no probe sequence is interrupted
+	for (std::size_t other = (entry + 1) % Slots;
+		 index[other].key != InvalidKey;
+		 other = (other + 1) % Slots)
+	{
+		const std::size_t home = hash(index[other].key);
+		if ((other + Slots - home) % Slots >= (other + Slots - entry) % Slots)
+		{
+			index[entry] = index[other];
+			entry = other;
+		}
+	}
+	index[entry].key = InvalidKey;
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+void
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::clear()
+{
+	for (Entry& entry : index) {
+		entry.key = InvalidKey;
+	}
+	std::fill_n(sequences, Sectors, 0);
+	std::fill_n(live, Sectors, 0);
+	count = 0;
+	head = 0;
+	used = 0;
+	erased = false;
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+uint32_t
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::parseSectorHeader() const
+{
+	uint32_t header[3];
+	std::memcpy(header, buffer, SectorHeaderSize);
+	if (header[0] != Magic or header[1] == 0 or
+		header[2] != modm::math::crc32(buffer, 2 * sizeof(uint32_t))) {
+		return 0;
+	}
+	return header[1];
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+uint32_t
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::headerCrc(uint32_t seed, const uint8_t* header)
+{
+	uint32_t crc = modm::math::crc32_init;
+	for (uint8_t ii = 0; ii < sizeof(seed); ii++) {
+		crc = modm::math::crc32_update(crc, uint8_t(seed >> (8 * ii)));
+	}
+	for (uint8_t ii = 0; ii < RecordHeaderSize - sizeof(uint32_t); ii++) {
+		crc = modm::math::crc32_update(crc, header[ii]);
+	}
+	return ~crc;
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::append(
+		Key key, uint16_t length, uint32_t crc, const uint8_t* buffer, bd_address_t source)
+{
+	RF_BEGIN();
+
+	appendKey = key;
+	appendLength = length;
+	writeBuffer = buffer;
+	copySource = source;
+	target = position;
+	remaining = (length == Tombstone) ? 0 : length;
+	{
+		// the header is programmed first, so that the record is only valid
+		// once the value matches its CRC
+		std::memcpy(this->buffer + 0, &key, sizeof(key));
+		std::memcpy(this->buffer + 2, &length, sizeof(length));
+		std::memcpy(this->buffer + 4, &crc, sizeof(crc));
+		const uint32_t checksum = headerCrc(sequences[head], this->buffer);
+		std::memcpy(this->buffer + 8, &checksum, sizeof(checksum));
+	}
+	fill = RecordHeaderSize;
+
+	while (true)
+	{
+		chunk = std::min<bd_size_t>(remaining, BufferSize - fill);
+		if (writeBuffer)
+		{
+			std::memcpy(this->buffer + fill, writeBuffer, chunk);
+			writeBuffer += chunk;
+		}
+		else if (chunk)
+		{
+			if (not RF_CALL(blockDevice.read(this->buffer + fill, copySource, chunk))) {
+				break;
+			}
+			copySource += chunk;
+		}
+		fill += chunk;
+		remaining -= chunk;
+		if (remaining == 0) {
+			break;
+		}
+
+		if (not RF_CALL(blockDevice.program(this->buffer, target, BufferSize))) {
+			break;
+		}
+		target += BufferSize;
+		fill = 0;
+	}
+
+	result = (remaining == 0);
+	if (result)
+	{
+		// the last chunk is padded to the write block size
+		chunk = align(fill);
+		std::memset(this->buffer + fill, 0xFF, chunk - fill);
+		result = RF_CALL(blockDevice.program(this->buffer, target, chunk));
+	}
+	if (not result)
+	{
+		// nothing may be programmed over the partially programmed record anymore
+		position = sectorAddress(head) + SectorSize;
+		RF_RETURN(false);
+	}
+
+	if (appendLength == Tombstone) {
+		removeEntry(appendKey);
+	}
+	else {
+		insert(appendKey, position, appendLength);
+	}
+	position += recordSize(appendLength);
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::allocate(bd_size_t size)
+{
+	RF_BEGIN();
+
+	// every rotation compacts a sector once all sectors are used, so after
+	// cycling through all of them the store is full of valid records
+	for (attempt = 0; attempt <= 2 * Sectors; attempt++)
+	{
+		// The oldest sector is compacted into the new sector before anything
+		// else is written into it, also if a previous compaction failed.
+		if (used == Sectors)
+		{
+			if (not RF_CALL(collect())) {
+				RF_RETURN(false);
+			}
+		}
+		if (getFree() >= size) {
+			RF_RETURN(true);
+		}
+		if (not RF_CALL(rotate())) {
+			RF_RETURN(false);
+		}
+	}
+
+	RF_END_RETURN(false);
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::rotate()
+{
+	RF_BEGIN();
+
+	// after a failed compaction the next sector is still in use until mount()
+	// recovers from it
+	if (used == Sectors) {
+		RF_RETURN(false);
+	}
+
+	if (not erased)
+	{
+		if (not RF_CALL(prepare(next(head)))) {
+			RF_RETURN(false);
+		}
+	}
+	erased = false;
+
+	{
+		const uint32_t header[3] = {Magic, ++lastSequence, 0};
+		std::memcpy(buffer, header, SectorHeaderSize);
+		const uint32_t checksum = modm::math::crc32(buffer, 2 * sizeof(uint32_t));
+		std::memcpy(buffer + 2 * sizeof(uint32_t), &checksum, sizeof(checksum));
+		std::memset(buffer + SectorHeaderSize, 0xFF, FirstRecord - SectorHeaderSize);
+	}
+	if (not RF_CALL(blockDevice.program(buffer, sectorAddress(next(head)), FirstRecord))) {
+		RF_RETURN(false);
+	}
+
+	head = next(head);
+	sequences[head] = lastSequence;
+	live[head] = 0;
+	position = sectorAddress(head) + FirstRecord;
+	used++;
+
+	RF_END_RETURN(true);
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::collect()
+{
+	RF_BEGIN();
+
+	victim = oldest();
+	if (getFree() < live[victim]) {
+		RF_RETURN(false);
+	}
+	// Only records in the index are copied. Tombstones are dropped, since no
+	// older sector is left that could contain the removed key.
+	for (slot = 0; slot < Slots; slot++)
+	{
+		if (index[slot].key == InvalidKey or index[slot].address / SectorSize != victim) {
+			continue;
+		}
+		// the copy keeps the CRC of the value, only the header CRC depends on the sector
+		if (not RF_CALL(blockDevice.read(reinterpret_cast<uint8_t*>(&copyCrc),
+										 index[slot].address + 4, sizeof(copyCrc)))) {
+			RF_RETURN(false);
+		}
+		// the entry is updated in place and now points into the head sector
+		if (not RF_CALL(append(index[slot].key, index[slot].length, copyCrc, nullptr,
+							   index[slot].address + RecordHeaderSize))) {
+			RF_RETURN(false);
+		}
+	}
+
+	if (not RF_CALL(retire(victim))) {
+		RF_RETURN(false);
+	}
+	sequences[victim] = 0;
+	live[victim] = 0;
+	used--;
+
+	RF_END_RETURN(true);
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::retire(std::size_t sector)
+{
+	RF_BEGIN();
+
+	// clearing the header invalidates the sector even if erasing it is interrupted
+	std::memset(buffer, 0, FirstRecord);
+
+	RF_END_RETURN_CALL(blockDevice.program(buffer, sectorAddress(sector), FirstRecord));
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::prepare(std::size_t sector)
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(blockDevice.erase(sectorAddress(sector), SectorSize))) {
+		RF_RETURN(false);
+	}
+
+	// The content of erased memory is undefined for some block devices, but
+	// the end of the log is found by the first header containing only 0xFF.
+	for (target = sectorAddress(sector); target < sectorAddress(sector) + SectorSize; target += chunk)
+	{
+		chunk = std::min<bd_size_t>(BufferSize, sectorAddress(sector) + SectorSize - target);
+		if (not RF_CALL(blockDevice.read(buffer, target, chunk))) {
+			RF_RETURN(false);
+		}
+		if (std::all_of(buffer, buffer + chunk, [](uint8_t byte) { return byte == 0xFF; })) {
+			continue;
+		}
+		std::memset(buffer, 0xFF, chunk);
+		if (not RF_CALL(blockDevice.program(buffer, target, chunk))) {
+			RF_RETURN(false);
+		}
+	}
+
+	RF_END_RETURN(true);
+}
+
+template <typename BackingDevice, std::size_t MaxKeys, std::size_t SectorSize>
+modm::ResumableResult<bool>
+modm::KeyValueStore<BackingDevice, MaxKeys, SectorSize>::verify(uint32_t sequence)
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(blockDevice.read(buffer, scan, RecordHeaderSize))) {
+		RF_RETURN(false);
+	}
+	if (std::all_of(buffer, buffer + RecordHeaderSize, [](uint8_t byte) { return byte == 0xFF; }))
+	{
+		state = Scan::Blank;
+		RF_RETURN(true);
+	}
+	{
+		uint32_t checksum;
+		std::memcpy(&recordKey, buffer + 0, sizeof(recordKey));
+		std::memcpy(&recordLength, buffer + 2, sizeof(recordLength));
+		std::memcpy(&recordCrc, buffer + 4, sizeof(recordCrc));
+		std::memcpy(&checksum, buffer + 8, sizeof(checksum));
+		if (checksum != headerCrc(sequence, buffer) or recordKey == InvalidKey or
+			(recordLength != Tombstone and recordLength > MaxValueSize) or
+			scan + recordSize(recordLength) > end)
+		{
+			state = Scan::Garbage;
+			RF_RETURN(true);
+		}
+	}
+
+	crc = modm::math::crc32_init;
+	copySource = scan + RecordHeaderSize;
+	remaining = (recordLength == Tombstone) ? 0 : recordLength;
+	while (remaining > 0)
+	{
+		chunk = std::min<bd_size_t>(remaining, BufferSize);
+		if (not RF_CALL(blockDevice.read(buffer, copySource, chunk))) {
+			RF_RETURN(false);
+		}
+		for (bd_size_t ii = 0; ii < chunk; ii++) {
+			crc = modm::math::crc32_update(crc, buffer[ii]);
+		}
+		copySource += chunk;
+		remaining -= chunk;
+	}
+	state = (~crc == recordCrc) ? Scan::Valid : Scan::Torn;
+
+	RF_END_RETURN(true);
+}
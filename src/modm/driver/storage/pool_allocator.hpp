@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace modm
+{
+
+/**
+ * Size-class pool allocator.
+ *
+ * Splits a memory area into pools of fixed-size blocks, one pool per size
+ * class. The block sizes are powers of two starting with `MINIMUM_SIZE`. Each
+ * pool keeps its free blocks in a singly-linked free-list, so that allocating
+ * and freeing a block takes a constant and very short time and cannot
+ * fragment the memory.
+ *
+ * The free-lists are lock-free on ARMv7-M and above using the exclusive
+ * load/store instructions, which also makes them safe to use from interrupts.
+ * On all other targets, the free-list operations are guarded by a
+ * `modm::atomic::Lock`.
+ *
+ * This allocator is intended to be placed in front of a general-purpose
+ * allocator that handles larger sizes and is used when a pool is exhausted.
+ *
+ * @tparam	SIZE_CLASSES
+ * 		Number of size classes
+ * @tparam	MINIMUM_SIZE
+ * 		Block size of the smallest size class in bytes, must be a power of two
+ * 		and at least the size of a pointer.
+ *
+ * @ingroup modm_driver_pool_allocator
+ */
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE = 16>
+class PoolAllocator
+{
+	static_assert(SIZE_CLASSES > 0, "At least one size class is required!");
+	static_assert((MINIMUM_SIZE & (MINIMUM_SIZE - 1)) == 0,
+				  "The minimum size must be a power of two!");
+	static_assert(MINIMUM_SIZE >= sizeof(void*),
+				  "The minimum size must be able to hold a pointer!");
+
+public:
+	static constexpr std::size_t SizeClasses = SIZE_CLASSES;
+	static constexpr std::size_t MinimumSize = MINIMUM_SIZE;
+	static constexpr std::size_t MaximumSize = MINIMUM_SIZE << (SIZE_CLASSES - 1);
+
+	/// @return the block size of the size class.
+	static constexpr std::size_t
+	blockSize(std::size_t sizeClass)
+	{
+		return MinimumSize << sizeClass;
+	}
+
+	/// @return the size class of the smallest block fitting the size.
+	static constexpr std::size_t
+	sizeClass(std::size_t size);
+
+	/// @return the memory required for the number of blocks in every size class.
+	static constexpr std::size_t
+	memorySize(std::size_t blocks)
+	{
+		return blocks * (blockSize(SizeClasses) - MinimumSize);
+	}
+
+	/**
+	 * Initialize the pools.
+	 *
+	 * Needs to be called before any calls to allocate() or free(). Must be
+	 * called only once!
+	 *
+	 * @param	memory
+	 * 		Memory area of at least `memorySize(blocks)` bytes, aligned to the
+	 * 		alignment required for the allocated objects.
+	 * @param	blocks
+	 * 		Number of blocks in each size class.
+	 */
+	void
+	initialize(void *memory, std::size_t blocks);
+
+	/**
+	 * Allocate a block from the pool of the size class fitting the size.
+	 *
+	 * @return	the block or `nullptr` if the size is larger than `MaximumSize`
+	 *			or if the pool is exhausted.
+	 */
+	void *
+	allocate(std::size_t size);
+
+	/**
+	 * Return a block to its pool in O(1).
+	 *
+	 * @return	`false` if the pointer does not belong to the pools and was
+	 *			not freed.
+	 */
+	bool
+	free(void *ptr);
+
+	/// @return `true` if the pointer belongs to the pools.
+	bool
+	owns(const void *ptr) const
+	{
+		return (bounds[0] <= ptr) and (ptr < bounds[SizeClasses]);
+	}
+
+	/// @return the block size of a pointer belonging to the pools.
+	std::size_t
+	getBlockSize(const void *ptr) const;
+
+	/// @return the number of free blocks in the pool of the size class.
+	std::size_t
+	getFreeBlocks(std::size_t sizeClass) const;
+
+private:
+	struct Block
+	{
+		Block *next;
+	};
+
+	static void
+	push(Block **head, Block *block);
+
+	static Block *
+	pop(Block **head);
+
+	std::size_t
+	findSizeClass(const void *ptr) const;
+
+	Block *freeList[SizeClasses]{};
+	uint8_t *bounds[SizeClasses + 1]{};
+};
+
+} // namespace modm
+
+#include "pool_allocator_impl.hpp"
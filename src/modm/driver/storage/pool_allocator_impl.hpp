@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <bit>
+#include <modm/architecture/interface/atomic_lock.hpp>
+
+// ----------------------------------------------------------------------------
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+constexpr std::size_t
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::sizeClass(std::size_t size)
+{
+	if (size <= MinimumSize) return 0;
+	return std::bit_width(size - 1) - std::bit_width(MinimumSize - 1);
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+void
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::initialize(void *memory, std::size_t blocks)
+{
+	uint8_t *block = static_cast<uint8_t *>(memory);
+	for (std::size_t sc = 0; sc < SizeClasses; sc++)
+	{
+		bounds[sc] = block;
+		// link the blocks in ascending order
+		Block **tail = &freeList[sc];
+		for (std::size_t ii = 0; ii < blocks; ii++)
+		{
+			*tail = reinterpret_cast<Block *>(block);
+			tail = &(*tail)->next;
+			block += blockSize(sc);
+		}
+		*tail = nullptr;
+	}
+	bounds[SizeClasses] = block;
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+void *
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::allocate(std::size_t size)
+{
+	if (size > MaximumSize) return nullptr;
+	return pop(&freeList[sizeClass(size)]);
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+bool
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::free(void *ptr)
+{
+	if (not owns(ptr)) return false;
+	push(&freeList[findSizeClass(ptr)], static_cast<Block *>(ptr));
+	return true;
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+std::size_t
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::getBlockSize(const void *ptr) const
+{
+	return blockSize(findSizeClass(ptr));
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+std::size_t
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::getFreeBlocks(std::size_t sizeClass) const
+{
+	modm::atomic::Lock lock;
+	std::size_t count = 0;
+	for (const Block *block = freeList[sizeClass]; block; block = block->next)
+		count++;
+	return count;
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+std::size_t
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::findSizeClass(const void *ptr) const
+{
+	std::size_t sc = 0;
+	while (ptr >= bounds[sc + 1]) sc++;
+	return sc;
+}
+
+// ----------------------------------------------------------------------------
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+/*
+ * The exclusive monitor is cleared on every exception return, so an interrupt
+ * modifying the list between the load and the store makes the store fail and
+ * the operation is retried. Since the next pointer is read inside the
+ * exclusive section, the pop operation does not suffer from the ABA problem.
+ */
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+void
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::push(Block **head, Block *block)
+{
+	uint32_t failed;
+	do
+	{
+		Block *first;
+		asm volatile ("ldrex %0, [%1]" : "=r" (first) : "r" (head) : "memory");
+		block->next = first;
+		asm volatile ("strex %0, %2, [%1]"
+					  : "=&r" (failed) : "r" (head), "r" (block) : "memory");
+	}
+	while (failed);
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+typename modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::Block *
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::pop(Block **head)
+{
+	uint32_t failed;
+	Block *block;
+	do
+	{
+		asm volatile ("ldrex %0, [%1]" : "=r" (block) : "r" (head) : "memory");
+		if (block == nullptr)
+		{
+			asm volatile ("clrex" ::: "memory");
+			break;
+		}
+		asm volatile ("strex %0, %2, [%1]"
+					  : "=&r" (failed) : "r" (head), "r" (block->next) : "memory");
+	}
+	while (failed);
+	return block;
+}
+#else
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+void
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::push(Block **head, Block *block)
+{
+	modm::atomic::Lock lock;
+	block->next = *head;
+	*head = block;
+}
+
+template <std::size_t SIZE_CLASSES, std::size_t MINIMUM_SIZE>
+typename modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::Block *
+modm::PoolAllocator<SIZE_CLASSES, MINIMUM_SIZE>::pop(Block **head)
+{
+	modm::atomic::Lock lock;
+	Block *block = *head;
+	if (block) *head = block->next;
+	return block;
+}
+#endif
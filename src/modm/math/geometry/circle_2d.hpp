@@ -28,7 +28,7 @@ namespace modm
 	template <typename T>
 	class LineSegment2D;
 
-	template <typename T>
+	template <typename T, typename Container>
 	class Polygon2D;
 
 	/**
@@ -61,8 +61,9 @@ namespace modm
 		setRadius(T radius);
 
 		/// Check if a intersection exists
+		template <typename Container>
 		bool
-		intersects(const Polygon2D<T>& polygon) const;
+		intersects(const Polygon2D<T, Container>& polygon) const;
 
 		/**
 		 * \brief	Calculate intersection point(s)
@@ -72,9 +73,10 @@ namespace modm
 		 *
 		 * \see		http://local.wasp.uwa.edu.au/~pbourke/geometry/2circle/
 		 */
+		template <typename Container>
 		bool
 		getIntersections(const Circle2D& other,
-				PointSet2D<T>& intersections) const;
+				PointSet2D<T, Container>& intersections) const;
 
 		/**
 		 * \brief	Calculate intersection point(s)
@@ -84,13 +86,15 @@ namespace modm
 		 *
 		 * \see		Line2D::intersect()
 		 */
+		template <typename Container>
 		bool
 		getIntersections(const Line2D<T>& line,
-				PointSet2D<T>& intersections) const;
+				PointSet2D<T, Container>& intersections) const;
 
+		template <typename Container>
 		bool
 		getIntersections(const LineSegment2D<T>& line,
-				PointSet2D<T>& intersections) const;
+				PointSet2D<T, Container>& intersections) const;
 
 	protected:
 		Vector<T, 2> center;
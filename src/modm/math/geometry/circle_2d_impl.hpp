@@ -60,17 +60,19 @@ modm::Circle2D<T>::setRadius(T newRadius)
 
 // ----------------------------------------------------------------------------
 template<typename T>
+template <typename Container>
 bool
-modm::Circle2D<T>::intersects(const Polygon2D<T>& polygon) const
+modm::Circle2D<T>::intersects(const Polygon2D<T, Container>& polygon) const
 {
 	return polygon.intersects(*this);
 }
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename Container>
 bool
 modm::Circle2D<T>::getIntersections(const Circle2D& other,
-		PointSet2D<T>& intersections) const
+		PointSet2D<T, Container>& intersections) const
 {
 	Vector<T, 2> circleToCircle = other.center - this->center;
 	WideType distanceSquared = circleToCircle.getLengthSquared();
@@ -126,18 +128,20 @@ modm::Circle2D<T>::getIntersections(const Circle2D& other,
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename Container>
 bool
 modm::Circle2D<T>::getIntersections(const Line2D<T>& line,
-		PointSet2D<T>& intersections) const
+		PointSet2D<T, Container>& intersections) const
 {
 	return line.getIntersections(*this, intersections);
 }
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename Container>
 bool
 modm::Circle2D<T>::getIntersections(const LineSegment2D<T>& line,
-		PointSet2D<T>& intersections) const
+		PointSet2D<T, Container>& intersections) const
 {
 	return line.getIntersections(*this, intersections);
 }
@@ -77,9 +77,10 @@ namespace modm
 		 * \param[in]	other	Other line
 		 * \param[out]	intersections	Intersection point
 		 */
+		template <typename Container>
 		bool
 		getIntersections(const Line2D& other,
-				PointSet2D<T>& intersections) const;
+				PointSet2D<T, Container>& intersections) const;
 
 		/**
 		 * \brief	Calculate intersection point(s)
@@ -89,9 +90,10 @@ namespace modm
 		 *
 		 * \see		http://local.wasp.uwa.edu.au/~pbourke/geometry/sphereline/
 		 */
+		template <typename Container>
 		bool
 		getIntersections(const Circle2D<T>& circle,
-				PointSet2D<T>& intersections) const;
+				PointSet2D<T, Container>& intersections) const;
 
 	protected:
 		Vector<T, 2> point;
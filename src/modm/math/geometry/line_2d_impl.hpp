@@ -88,9 +88,10 @@ modm::Line2D<T>::getDistanceTo(const Vector<T, 2>& point) const
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename Container>
 bool
 modm::Line2D<T>::getIntersections(const Line2D& other,
-		PointSet2D<T>& intersections) const
+		PointSet2D<T, Container>& intersections) const
 {
 	modm::Vector<T, 2> connectionVector = this->point - other.point;
 
@@ -108,9 +109,10 @@ modm::Line2D<T>::getIntersections(const Line2D& other,
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename Container>
 bool
 modm::Line2D<T>::getIntersections(const Circle2D<T>& circle,
-		PointSet2D<T>& intersections) const
+		PointSet2D<T, Container>& intersections) const
 {
 	// vector from the center of the circle to line start
 	modm::Vector<T, 2> circleToLine = this->point - circle.center;
@@ -25,7 +25,7 @@ namespace modm
 	template <typename T>
 	class Circle2D;
 
-	template <typename T>
+	template <typename T, typename Container>
 	class Polygon2D;
 
 	/**
@@ -93,28 +93,32 @@ namespace modm
 		intersects(const LineSegment2D& other) const;
 
 		/// Check if a intersection exists
+		template <typename Container>
 		bool
-		intersects(const Polygon2D<T>& polygon) const;
+		intersects(const Polygon2D<T, Container>& polygon) const;
 
 		/**
 		 * \brief	Calculate the intersection point
 		 */
+		template <typename Container>
 		bool
 		getIntersections(const LineSegment2D& other,
-				PointSet2D<T>& intersectionPoints) const;
+				PointSet2D<T, Container>& intersectionPoints) const;
 
 		/**
 		 * \brief	Calculate the intersection point(s)
 		 *
 		 * \see		http://local.wasp.uwa.edu.au/~pbourke/geometry/sphereline/
 		 */
+		template <typename Container>
 		bool
 		getIntersections(const Circle2D<T>& circle,
-				PointSet2D<T>& intersectionPoints) const;
+				PointSet2D<T, Container>& intersectionPoints) const;
 
+		template <typename PolygonContainer, typename Container>
 		bool
-		getIntersections(const Polygon2D<T>& polygon,
-				PointSet2D<T>& intersectionPoints) const;
+		getIntersections(const Polygon2D<T, PolygonContainer>& polygon,
+				PointSet2D<T, Container>& intersectionPoints) const;
 
 		bool
 		operator == (const LineSegment2D &other) const;
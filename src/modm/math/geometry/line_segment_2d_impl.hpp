@@ -169,17 +169,19 @@ modm::LineSegment2D<T>::intersects(const LineSegment2D<T>& other) const
 
 // ----------------------------------------------------------------------------
 template<typename T>
+template <typename Container>
 bool
-modm::LineSegment2D<T>::intersects(const Polygon2D<T>& polygon) const
+modm::LineSegment2D<T>::intersects(const Polygon2D<T, Container>& polygon) const
 {
 	return polygon.intersects(*this);
 }
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename Container>
 bool
 modm::LineSegment2D<T>::getIntersections(const LineSegment2D& other,
-		PointSet2D<T>& intersectionPoints) const
+		PointSet2D<T, Container>& intersectionPoints) const
 {
 	modm::Vector<T, 2> ownDirectionVector = this->endPoint - this->startPoint;
 	modm::Vector<T, 2> otherDirectionVector = other.endPoint - other.startPoint;
@@ -208,9 +210,10 @@ modm::LineSegment2D<T>::getIntersections(const LineSegment2D& other,
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename Container>
 bool
 modm::LineSegment2D<T>::getIntersections(const Circle2D<T>& circle,
-		PointSet2D<T>& intersectionPoints) const
+		PointSet2D<T, Container>& intersectionPoints) const
 {
 	// Direction vector of line, from start to end
 	modm::Vector<T, 2> directionVector = this->endPoint - this->startPoint;
@@ -259,9 +262,10 @@ modm::LineSegment2D<T>::getIntersections(const Circle2D<T>& circle,
 
 // ----------------------------------------------------------------------------
 template <typename T>
+template <typename PolygonContainer, typename Container>
 bool
-modm::LineSegment2D<T>::getIntersections(const Polygon2D<T>& polygon,
-		PointSet2D<T>& intersectionPoints) const
+modm::LineSegment2D<T>::getIntersections(const Polygon2D<T, PolygonContainer>& polygon,
+		PointSet2D<T, Container>& intersectionPoints) const
 {
 	// invoke intersection method of the polygon
 	return polygon.getIntersections(*this, intersectionPoints);
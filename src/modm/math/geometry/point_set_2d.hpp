@@ -25,19 +25,28 @@ namespace modm
 	 * Collection of points, represented by their corresponding vectors.
 	 * Used for example to hold the result of a intersection-operation.
 	 *
-	 * Based on the modm::DynamicArray class, therefore grows automatically
-	 * if more space than currently allocated is needed. But because this
-	 * is an expensive operation it should be avoid if possible.
+	 * Based on the modm::DynamicArray class by default, therefore grows
+	 * automatically if more space than currently allocated is needed. But
+	 * because this is an expensive operation it should be avoid if possible.
+	 *
+	 * Any container with the interface of modm::DynamicArray can be used
+	 * instead, for example modm::static_vector to store the points without
+	 * allocating memory, or modm::small_vector to only allocate memory for
+	 * large sets.
+	 *
+	 * \tparam	T			Type of the coordinates
+	 * \tparam	Container	Container of `Vector<T, 2>` storing the points
 	 *
 	 * \author	Fabian Greif
 	 * \ingroup	modm_math_geometry
 	 */
-	template <typename T>
+	template <typename T, typename Container = DynamicArray< Vector<T, 2> >>
 	class PointSet2D
 	{
 	public:
 		using SizeType = std::size_t;
 		using PointType = Vector<T, 2>;
+		using ContainerType = Container;
 
 	public:
 		/**
@@ -49,6 +58,10 @@ namespace modm
 
 		PointSet2D(const PointSet2D& other);
 
+		/// Copies the points of a set stored in another type of container
+		template <typename OtherContainer>
+		explicit PointSet2D(const PointSet2D<T, OtherContainer>& other);
+
 		PointSet2D&
 		operator = (const PointSet2D& other);
 
@@ -73,8 +86,8 @@ namespace modm
 		removeAll();
 
 	public:
-		typedef typename modm::DynamicArray< PointType >::iterator iterator;
-		typedef typename modm::DynamicArray< PointType >::const_iterator const_iterator;
+		typedef typename Container::iterator iterator;
+		typedef typename Container::const_iterator const_iterator;
 
 		inline iterator
 		begin();
@@ -89,7 +102,7 @@ namespace modm
 		end() const;
 
 	protected:
-		modm::DynamicArray< PointType > points;
+		Container points;
 	};
 }
 
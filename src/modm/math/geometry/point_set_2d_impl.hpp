@@ -17,96 +17,106 @@
 #endif
 
 // ----------------------------------------------------------------------------
-template <typename T>
-modm::PointSet2D<T>::PointSet2D(SizeType n) :
-	points(n)
+template <typename T, typename Container>
+modm::PointSet2D<T, Container>::PointSet2D(SizeType n)
 {
+	points.reserve(n);
 }
 
-template <typename T>
-modm::PointSet2D<T>::PointSet2D(std::initializer_list<modm::PointSet2D<T>::PointType> init) :
+template <typename T, typename Container>
+modm::PointSet2D<T, Container>::PointSet2D(std::initializer_list<modm::PointSet2D<T, Container>::PointType> init) :
 	points(init)
 {
 }
 
-template <typename T>
-modm::PointSet2D<T>::PointSet2D(const PointSet2D<T>& other) :
+template <typename T, typename Container>
+modm::PointSet2D<T, Container>::PointSet2D(const PointSet2D<T, Container>& other) :
 	points(other.points)
 {
 }
 
-template <typename T>
-modm::PointSet2D<T>&
-modm::PointSet2D<T>::operator = (const PointSet2D<T>& other)
+template <typename T, typename Container>
+template <typename OtherContainer>
+modm::PointSet2D<T, Container>::PointSet2D(const PointSet2D<T, OtherContainer>& other)
+{
+	points.reserve(other.getNumberOfPoints());
+	for (const PointType& point : other) {
+		points.append(point);
+	}
+}
+
+template <typename T, typename Container>
+modm::PointSet2D<T, Container>&
+modm::PointSet2D<T, Container>::operator = (const PointSet2D<T, Container>& other)
 {
 	this->points = other.points;
 	return *this;
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
-typename modm::PointSet2D<T>::SizeType
-modm::PointSet2D<T>::getNumberOfPoints() const
+template <typename T, typename Container>
+typename modm::PointSet2D<T, Container>::SizeType
+modm::PointSet2D<T, Container>::getNumberOfPoints() const
 {
 	return points.getSize();
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
 void
-modm::PointSet2D<T>::append(const modm::PointSet2D<T>::PointType& point)
+modm::PointSet2D<T, Container>::append(const modm::PointSet2D<T, Container>::PointType& point)
 {
 	points.append(point);
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
-typename modm::PointSet2D<T>::PointType&
-modm::PointSet2D<T>::operator [](SizeType index)
+template <typename T, typename Container>
+typename modm::PointSet2D<T, Container>::PointType&
+modm::PointSet2D<T, Container>::operator [](SizeType index)
 {
 	return points[index];
 }
 
-template <typename T>
-const typename modm::PointSet2D<T>::PointType&
-modm::PointSet2D<T>::operator [](SizeType index) const
+template <typename T, typename Container>
+const typename modm::PointSet2D<T, Container>::PointType&
+modm::PointSet2D<T, Container>::operator [](SizeType index) const
 {
 	return points[index];
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
 void
-modm::PointSet2D<T>::removeAll()
+modm::PointSet2D<T, Container>::removeAll()
 {
 	points.removeAll();
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
-typename modm::PointSet2D<T>::iterator
-modm::PointSet2D<T>::begin()
+template <typename T, typename Container>
+typename modm::PointSet2D<T, Container>::iterator
+modm::PointSet2D<T, Container>::begin()
 {
 	return points.begin();
 }
 
-template <typename T>
-typename modm::PointSet2D<T>::iterator
-modm::PointSet2D<T>::end()
+template <typename T, typename Container>
+typename modm::PointSet2D<T, Container>::iterator
+modm::PointSet2D<T, Container>::end()
 {
 	return points.end();
 }
 
-template <typename T>
-typename modm::PointSet2D<T>::const_iterator
-modm::PointSet2D<T>::begin() const
+template <typename T, typename Container>
+typename modm::PointSet2D<T, Container>::const_iterator
+modm::PointSet2D<T, Container>::begin() const
 {
 	return points.begin();
 }
 
-template <typename T>
-typename modm::PointSet2D<T>::const_iterator
-modm::PointSet2D<T>::end() const
+template <typename T, typename Container>
+typename modm::PointSet2D<T, Container>::const_iterator
+modm::PointSet2D<T, Container>::end() const
 {
 	return points.end();
 }
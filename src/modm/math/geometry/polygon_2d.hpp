@@ -35,14 +35,17 @@ namespace modm
 	 * The Polygon class provides a vector of points. The polygon is
 	 * implicit closed, which means the first and the last point are connected.
 	 *
+	 * The points are stored in a modm::DynamicArray by default, see
+	 * modm::PointSet2D for other containers.
+	 *
 	 * \author	Fabian Greif
 	 * \ingroup	modm_math_geometry
 	 */
-	template <typename T>
-	class Polygon2D : public PointSet2D<T>
+	template <typename T, typename Container = DynamicArray< Vector<T, 2> >>
+	class Polygon2D : public PointSet2D<T, Container>
 	{
 		using SizeType = std::size_t;
-		using PointType = typename PointSet2D<T>::PointType;
+		using PointType = typename PointSet2D<T, Container>::PointType;
 	public:
 		/**
 		 * \brief	Constructs a polygon capable of holding n points
@@ -66,8 +69,9 @@ namespace modm
 		 * \todo	Currently a brute force approach is used here,
 		 * 			needs to be optimized
 		 */
+		template <typename OtherContainer>
 		bool
-		intersects(const Polygon2D& other) const;
+		intersects(const Polygon2D<T, OtherContainer>& other) const;
 
 		/// Check if a intersection exists
 		bool
@@ -84,9 +88,10 @@ namespace modm
 		/**
 		 * \brief	Calculate the intersection point(s)
 		 */
+		template <typename PointContainer>
 		bool
 		getIntersections(const LineSegment2D<T>& segment,
-				PointSet2D<T>& intersectionPoints) const;
+				PointSet2D<T, PointContainer>& intersectionPoints) const;
 
 		/**
 		 * Check if the point is contained inside the area of the polygon.
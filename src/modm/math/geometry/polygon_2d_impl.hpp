@@ -17,55 +17,56 @@
 #endif
 
 // ----------------------------------------------------------------------------
-template <typename T>
-modm::Polygon2D<T>::Polygon2D(SizeType n) :
-	PointSet2D<T>(n)
+template <typename T, typename Container>
+modm::Polygon2D<T, Container>::Polygon2D(SizeType n) :
+	PointSet2D<T, Container>(n)
 {
 }
 
-template <typename T>
-modm::Polygon2D<T>::Polygon2D(const Polygon2D<T>& other) :
-	PointSet2D<T>(other)
+template <typename T, typename Container>
+modm::Polygon2D<T, Container>::Polygon2D(const Polygon2D<T, Container>& other) :
+	PointSet2D<T, Container>(other)
 {
 }
 
-template <typename T>
-modm::Polygon2D<T>::Polygon2D(std::initializer_list<modm::Polygon2D<T>::PointType> init) :
-	PointSet2D<T>(init)
+template <typename T, typename Container>
+modm::Polygon2D<T, Container>::Polygon2D(std::initializer_list<modm::Polygon2D<T, Container>::PointType> init) :
+	PointSet2D<T, Container>(init)
 {
 }
 
-template <typename T>
-modm::Polygon2D<T>&
-modm::Polygon2D<T>::operator = (const Polygon2D<T>& other)
+template <typename T, typename Container>
+modm::Polygon2D<T, Container>&
+modm::Polygon2D<T, Container>::operator = (const Polygon2D<T, Container>& other)
 {
 	this->points = other.points;
 	return *this;
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
-modm::Polygon2D<T>&
-modm::Polygon2D<T>::operator << (const modm::Polygon2D<T>::PointType& point)
+template <typename T, typename Container>
+modm::Polygon2D<T, Container>&
+modm::Polygon2D<T, Container>::operator << (const modm::Polygon2D<T, Container>::PointType& point)
 {
 	this->append(point);
 	return *this;
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
+template <typename OtherContainer>
 bool
-modm::Polygon2D<T>::intersects(const Polygon2D& other) const
+modm::Polygon2D<T, Container>::intersects(const Polygon2D<T, OtherContainer>& other) const
 {
 	SizeType n = this->points.getSize();
-	SizeType m = other.points.getSize();
+	SizeType m = other.getNumberOfPoints();
 
 	for (SizeType i = 0; i < n; ++i)
 	{
 		for (SizeType k = 0; k < m; ++k)
 		{
 			LineSegment2D<T> lineSegmentOwn(this->points[i], this->points[(i + 1) % n]);
-			LineSegment2D<T> lineSegmentOther(other.points[k], other.points[(k + 1) % m]);
+			LineSegment2D<T> lineSegmentOther(other[k], other[(k + 1) % m]);
 
 			if (lineSegmentOwn.intersects(lineSegmentOther)) {
 				return true;
@@ -77,9 +78,9 @@ modm::Polygon2D<T>::intersects(const Polygon2D& other) const
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
 bool
-modm::Polygon2D<T>::intersects(const Circle2D<T>& circle) const
+modm::Polygon2D<T, Container>::intersects(const Circle2D<T>& circle) const
 {
 	SizeType n = this->points.getSize();
 	for (SizeType i = 0; i < n; ++i)
@@ -96,9 +97,9 @@ modm::Polygon2D<T>::intersects(const Circle2D<T>& circle) const
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
 bool
-modm::Polygon2D<T>::intersects(const LineSegment2D<T>& segment) const
+modm::Polygon2D<T, Container>::intersects(const LineSegment2D<T>& segment) const
 {
 	SizeType n = this->points.getSize();
 	for (SizeType i = 0; i < n; ++i)
@@ -114,9 +115,9 @@ modm::Polygon2D<T>::intersects(const LineSegment2D<T>& segment) const
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
 bool
-modm::Polygon2D<T>::intersects(const Ray2D<T>& segment) const
+modm::Polygon2D<T, Container>::intersects(const Ray2D<T>& segment) const
 {
 	SizeType n = this->points.getSize();
 	for (SizeType i = 0; i < n; ++i)
@@ -132,9 +133,10 @@ modm::Polygon2D<T>::intersects(const Ray2D<T>& segment) const
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
+template <typename PointContainer>
 bool
-modm::Polygon2D<T>::getIntersections(const LineSegment2D<T>& segment, PointSet2D<T>& intersectionPoints) const
+modm::Polygon2D<T, Container>::getIntersections(const LineSegment2D<T>& segment, PointSet2D<T, PointContainer>& intersectionPoints) const
 {
 	bool intersectionFound = false;
 
@@ -152,9 +154,9 @@ modm::Polygon2D<T>::getIntersections(const LineSegment2D<T>& segment, PointSet2D
 }
 
 // ----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Container>
 bool
-modm::Polygon2D<T>::isInside(const modm::Polygon2D<T>::PointType& point)
+modm::Polygon2D<T, Container>::isInside(const modm::Polygon2D<T, Container>::PointType& point)
 {
 	bool cw = true;
 	bool ccw = true;
@@ -25,7 +25,7 @@ namespace modm
 	template <typename T>
 	class Circle2D;
 
-	template <typename T>
+	template <typename T, typename Container>
 	class Polygon2D;
 
 	template <typename T>
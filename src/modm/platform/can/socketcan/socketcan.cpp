@@ -26,20 +26,30 @@
 
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
 #include <string.h>
+#include <errno.h>
+#include <algorithm>
+#include <cstring>
 
 #undef  MODM_LOG_LEVEL
 #define MODM_LOG_LEVEL modm::log::DEBUG
 
+#ifndef CANFD_FDF
+// Marks CAN-FD frames since Linux 5.14, older kernels ignore the flag
+#define CANFD_FDF 0x04
+#endif
+
 modm::platform::SocketCan::~SocketCan()
 {
 	close();
 }
 
 bool
-modm::platform::SocketCan::open(std::string deviceName)
+modm::platform::SocketCan::open(std::string deviceName, TransmitMode mode)
 {
 	close();
+	transmitMode = mode;
 
 	skt = socket(PF_CAN, SOCK_RAW, CAN_RAW);
 	if (skt == -1) {
@@ -90,6 +100,15 @@ modm::platform::SocketCan::open(std::string deviceName)
 
 	fcntl(skt, F_SETFL, O_NONBLOCK);
 
+	/* Receive timestamps, from the hardware if available */
+	int timestamping = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+					   SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+	if (setsockopt(skt, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping)) < 0)
+	{
+		MODM_LOG_DEBUG << MODM_FILE_INFO;
+		MODM_LOG_DEBUG << "Receive timestamps are not available: " << strerror(errno) << modm::endl;
+	}
+
 	MODM_LOG_DEBUG << MODM_FILE_INFO;
 	MODM_LOG_DEBUG << "SocketCAN opened successfully with skt = " << skt << modm::endl;
 
@@ -103,6 +122,32 @@ modm::platform::SocketCan::close()
 		::close(skt);
 		skt = -1;
 	}
+	rxCount = rxIndex = txCount = 0;
+}
+
+bool
+modm::platform::SocketCan::setFilters(std::span<const Filter> filters)
+{
+	struct can_filter kernelFilters[CAN_RAW_FILTER_MAX];
+	if (filters.size() > CAN_RAW_FILTER_MAX) {
+		return false;
+	}
+	if (filters.empty()) {
+		// accept all frames
+		kernelFilters[0] = {0, 0};
+	}
+	for (std::size_t ii = 0; ii < filters.size(); ++ii) {
+		kernelFilters[ii] = filters[ii].filter;
+	}
+	const std::size_t count = std::max<std::size_t>(filters.size(), 1);
+	if (setsockopt(skt, SOL_CAN_RAW, CAN_RAW_FILTER, kernelFilters,
+				   count * sizeof(struct can_filter)) < 0)
+	{
+		MODM_LOG_ERROR << MODM_FILE_INFO;
+		MODM_LOG_ERROR << "Could not set CAN filters: " << strerror(errno) << modm::endl;
+		return false;
+	}
+	return true;
 }
 
 modm::Can::BusState
@@ -114,70 +159,164 @@ modm::platform::SocketCan::getBusState()
 bool
 modm::platform::SocketCan::isMessageAvailable()
 {
-	struct canfd_frame frame;
-	int nbytes = recv(skt, &frame, sizeof(struct canfd_frame), MSG_DONTWAIT | MSG_PEEK);
-
-	// recv returns 'Resource temporary not available' which is wired but ignored here.
-	/* if (nbytes < 0)
-	{
-		MODM_LOG_DEBUG << MODM_FILE_INFO;
-		MODM_LOG_DEBUG << strerror(errno) << modm::endl;
-	} */
-
-	return (nbytes > 0);
+	return receive();
 }
 
 bool
 modm::platform::SocketCan::getMessage(can::Message& message)
 {
-	struct canfd_frame frame;
-	int nbytes = recv(skt, &frame, sizeof(frame), MSG_DONTWAIT);
+	Timestamp timestamp;
+	return getMessage(message, timestamp);
+}
 
-	if (nbytes > 0)
+bool
+modm::platform::SocketCan::getMessage(can::Message& message, Timestamp& timestamp)
+{
+	while (receive())
 	{
+		const canfd_frame& frame = rxFrames[rxIndex];
+		const std::size_t size = rxHeaders[rxIndex].msg_len;
+		timestamp = rxTimestamps[rxIndex];
+		rxIndex++;
+
+		// the size tells CAN and CAN-FD frames apart
+		if (size != CAN_MTU and size != CANFD_MTU) {
+			continue;
+		}
+		const bool flexibleData = (size == CANFD_MTU);
 		if (frame.len > modm::can::Message::capacity)
 		{
 			MODM_LOG_ERROR << MODM_FILE_INFO;
 			MODM_LOG_ERROR << "Received can frame too big for configured buffer." << modm::endl;
-			return false;
+			continue;
 		}
-		message.identifier = frame.can_id;
+		message.identifier = frame.can_id & CAN_EFF_MASK;
 		message.setLength(frame.len);
+		message.setFlexibleData(flexibleData);
+		message.flags.brs = flexibleData and (frame.flags & CANFD_BRS);
 		message.setExtended(frame.can_id & CAN_EFF_FLAG);
-		message.setRemoteTransmitRequest(frame.can_id & CAN_RTR_FLAG);
-		for (uint8_t ii = 0; ii < frame.len; ++ii) {
-			message.data[ii] = frame.data[ii];
-		}
+		// CAN-FD frames have no remote frames and the flag is reserved
+		message.setRemoteTransmitRequest(not flexibleData and (frame.can_id & CAN_RTR_FLAG));
+		std::copy_n(frame.data, frame.len, message.data);
 		return true;
 	}
 	return false;
 }
 
+bool
+modm::platform::SocketCan::isReadyToSend()
+{
+	return txCount < BatchSize or flush();
+}
+
 bool
 modm::platform::SocketCan::sendMessage(const can::Message& message)
 {
-	struct canfd_frame frame;
+	if (txCount == BatchSize and not flush()) {
+		return false;
+	}
 
-	frame.flags = 0;
+	canfd_frame& frame = txFrames[txCount];
+	frame = {};
 	frame.can_id = message.identifier;
 	if (message.isExtended()) {
 		frame.can_id |= CAN_EFF_FLAG;
 	}
-	if (message.isRemoteTransmitRequest()) {
+	if (message.isFlexibleData())
+	{
+		frame.flags = CANFD_FDF;
+		if (message.isBitRateSwitching()) {
+			frame.flags |= CANFD_BRS;
+		}
+	}
+	else if (message.isRemoteTransmitRequest()) {
 		frame.can_id |= CAN_RTR_FLAG;
 	}
-
 	frame.len = message.getLength();
+	std::copy_n(message.data, message.getLength(), frame.data);
+	txCount++;
 
-	for (uint8_t ii = 0; ii < message.getLength(); ++ii) {
-		frame.data[ii] = message.data[ii];
+	if (transmitMode == TransmitMode::Immediate)
+	{
+		// A frame which could not be sent is dropped, like before batching
+		const bool sent = flush();
+		txCount = 0;
+		return sent;
+	}
+	if (txCount == BatchSize) {
+		flush();
 	}
+	return true;
+}
 
-	// Send can_frame when length < 8, since other applications may not accept
-	// canfd_frame. Both structs intentionally share the same layout
-	// for this purpose
-	int size = message.getLength() > 8 ? sizeof(canfd_frame) : sizeof(can_frame);
-	int bytes_sent = write(skt, &frame, size);
+bool
+modm::platform::SocketCan::flush()
+{
+	if (txCount == 0) {
+		return true;
+	}
+	for (std::size_t ii = 0; ii < txCount; ++ii)
+	{
+		// Both structs intentionally share the same layout, so that classic
+		// frames are sent as can_frame, which all applications accept
+		const bool flexibleData = txFrames[ii].flags & CANFD_FDF;
+		txVectors[ii] = {&txFrames[ii], flexibleData ? CANFD_MTU : CAN_MTU};
+		txHeaders[ii] = {};
+		txHeaders[ii].msg_hdr.msg_iov = &txVectors[ii];
+		txHeaders[ii].msg_hdr.msg_iovlen = 1;
+	}
+	const int sent = sendmmsg(skt, txHeaders.data(), txCount, MSG_DONTWAIT);
+	if (sent <= 0) {
+		return false;
+	}
+	// keep the frames which did not fit into the kernel queue
+	std::copy(txFrames.begin() + sent, txFrames.begin() + txCount, txFrames.begin());
+	txCount -= sent;
+	return txCount == 0;
+}
+
+bool
+modm::platform::SocketCan::receive()
+{
+	if (rxIndex < rxCount) {
+		return true;
+	}
+	if (transmitMode == TransmitMode::Batched) {
+		flush();
+	}
+	rxIndex = rxCount = 0;
+	for (std::size_t ii = 0; ii < BatchSize; ++ii)
+	{
+		rxVectors[ii] = {&rxFrames[ii], sizeof(canfd_frame)};
+		rxHeaders[ii] = {};
+		rxHeaders[ii].msg_hdr.msg_iov = &rxVectors[ii];
+		rxHeaders[ii].msg_hdr.msg_iovlen = 1;
+		rxHeaders[ii].msg_hdr.msg_control = rxControl[ii].buffer;
+		rxHeaders[ii].msg_hdr.msg_controllen = sizeof(rxControl[ii].buffer);
+	}
+	const int received = recvmmsg(skt, rxHeaders.data(), BatchSize, MSG_DONTWAIT, nullptr);
+	if (received <= 0) {
+		return false;
+	}
 
-	return (bytes_sent > 0);
+	for (int ii = 0; ii < received; ++ii)
+	{
+		rxTimestamps[ii] = Timestamp::zero();
+		msghdr& header = rxHeaders[ii].msg_hdr;
+		for (cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg))
+		{
+			if (cmsg->cmsg_level == SOL_SOCKET and cmsg->cmsg_type == SO_TIMESTAMPING)
+			{
+				scm_timestamping timestamps;
+				std::memcpy(&timestamps, CMSG_DATA(cmsg), sizeof(timestamps));
+				// prefer the raw hardware timestamp over the software one
+				const timespec& time = (timestamps.ts[2].tv_sec or timestamps.ts[2].tv_nsec) ?
+						timestamps.ts[2] : timestamps.ts[0];
+				rxTimestamps[ii] = std::chrono::seconds(time.tv_sec) +
+								   std::chrono::nanoseconds(time.tv_nsec);
+			}
+		}
+	}
+	rxCount = received;
+	return true;
 }
@@ -13,9 +13,20 @@
 #ifndef MODM_HOSTED_SOCKETCAN_HPP
 #define MODM_HOSTED_SOCKETCAN_HPP
 
-#include <iostream>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <linux/can.h>
+#include <linux/errqueue.h>
 
 #include <modm/architecture/interface/can.hpp>
+#include <modm/architecture/interface/can_filter.hpp>
 
 namespace modm
 {
@@ -23,28 +34,115 @@ namespace modm
 namespace platform
 {
 
-/// @ingroup modm_platform_socketcan
+/**
+ * CAN and CAN-FD frames over a Linux SocketCAN interface.
+ *
+ * Frames are received in batches of up to `BatchSize` frames with a single
+ * `recvmmsg()` call into an internal buffer, from which `getMessage()` takes
+ * them one by one. Each received frame carries the receive timestamp of the
+ * kernel, which is taken from the hardware if the driver supports it.
+ *
+ * In the batched transmit mode, `sendMessage()` only queues the frames, which
+ * are sent with a single `sendmmsg()` call when the queue is full, when
+ * `flush()` is called or when new frames are received with
+ * `isMessageAvailable()` or `getMessage()`. In the default immediate mode
+ * every frame is sent by `sendMessage()`.
+ *
+ * CAN-FD frames are sent for messages with the flexible data flag, which may
+ * also request the bit rate switch. The flags of received frames are set
+ * accordingly.
+ *
+ * The filters are applied by the kernel, so that unwanted frames do not even
+ * reach the process.
+ *
+ * \code
+ * modm::platform::SocketCan can;
+ * can.open("vcan0", modm::platform::SocketCan::TransmitMode::Batched);
+ * const modm::platform::SocketCan::Filter filters[] = {
+ *     {modm::can::StandardIdentifier{0x100}, modm::can::StandardMask{0x700}},
+ *     {modm::can::ExtendedIdentifier{0x1234'5678}, modm::can::ExtendedMask{0x1fff'ffff}}};
+ * can.setFilters(filters);
+ * \endcode
+ *
+ * @ingroup modm_platform_socketcan
+ */
 class SocketCan : public ::modm::Can
 {
 public:
+	/// Maximum number of frames transferred by one system call
+	static constexpr std::size_t BatchSize = 32;
+
+	/// Time since the epoch of `CLOCK_REALTIME`
+	using Timestamp = std::chrono::nanoseconds;
+
+	enum class
+	TransmitMode
+	{
+		Immediate,	///< Every frame is sent by `sendMessage()`
+		Batched,	///< Frames are queued and sent together
+	};
+
+	/**
+	 * Accepts frames with `received_identifier & mask == identifier & mask`.
+	 *
+	 * Standard and extended frames are distinguished, a filter only accepts
+	 * frames with the same identifier length.
+	 */
+	class Filter
+	{
+	public:
+		constexpr
+		Filter(can::StandardIdentifier id, can::StandardMask mask) :
+			filter{canid_t(id.id & CAN_SFF_MASK), canid_t(mask.mask & CAN_SFF_MASK) | CAN_EFF_FLAG}
+		{}
+
+		constexpr
+		Filter(can::ExtendedIdentifier id, can::ExtendedMask mask) :
+			filter{canid_t(id.id & CAN_EFF_MASK) | CAN_EFF_FLAG, canid_t(mask.mask & CAN_EFF_MASK) | CAN_EFF_FLAG}
+		{}
+
+	private:
+		friend class SocketCan;
+		// the EFF flag must match in both cases
+		can_filter filter;
+	};
+
 	SocketCan() = default;
 
+	SocketCan(const SocketCan&) = delete;
+
+	SocketCan&
+	operator = (const SocketCan&) = delete;
+
 	~SocketCan();
 
 	bool
-	open(std::string deviceName);
+	open(std::string deviceName, TransmitMode mode = TransmitMode::Immediate);
 
 	void
 	close();
 
+	/**
+	 * Replaces the filters of the kernel. An empty list restores the
+	 * default, which accepts all frames.
+	 *
+	 * @return	`false` if the kernel rejected the filters
+	 */
+	bool
+	setFilters(std::span<const Filter> filters);
+
 	bool
 	isMessageAvailable();
 
 	bool
 	getMessage(can::Message& message);
 
-	inline bool
-	isReadyToSend() { return true; }
+	/// Gets the next message and its receive timestamp
+	bool
+	getMessage(can::Message& message, Timestamp& timestamp);
+
+	bool
+	isReadyToSend();
 
 	BusState
 	getBusState();
@@ -52,8 +150,46 @@ public:
 	bool
 	sendMessage(const can::Message& message);
 
+	/**
+	 * Sends the queued frames.
+	 *
+	 * @return	`false` if frames remain queued, because the transmit queue
+	 * 			of the kernel is full.
+	 */
+	bool
+	flush();
+
+	/// File descriptor of the socket, for example for an external event loop
+	int
+	getFileDescriptor() const
+	{ return skt; }
+
 private:
+	/// Receives the next batch, if all frames of the last batch are taken
+	bool
+	receive();
+
 	int skt{-1};
+	TransmitMode transmitMode{TransmitMode::Immediate};
+
+	// Receive batch
+	struct ReceiveControl
+	{
+		alignas(cmsghdr) uint8_t buffer[CMSG_SPACE(sizeof(scm_timestamping))];
+	};
+	std::array<canfd_frame, BatchSize> rxFrames;
+	std::array<Timestamp, BatchSize> rxTimestamps;
+	std::array<ReceiveControl, BatchSize> rxControl;
+	std::array<iovec, BatchSize> rxVectors;
+	std::array<mmsghdr, BatchSize> rxHeaders;
+	std::size_t rxCount{0};
+	std::size_t rxIndex{0};
+
+	// Transmit queue
+	std::array<canfd_frame, BatchSize> txFrames;
+	std::array<iovec, BatchSize> txVectors;
+	std::array<mmsghdr, BatchSize> txHeaders;
+	std::size_t txCount{0};
 };
 
 } // namespace platform
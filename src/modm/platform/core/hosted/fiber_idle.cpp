@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/processing/fiber.hpp>
+#include <thread>
+
+void
+modm::fiber::idle(std::chrono::microseconds timeout)
+{
+	// Without a deadline, all fibers wait for a notification, so check regularly
+	if (timeout == std::chrono::microseconds::max()) timeout = std::chrono::milliseconds(1);
+	std::this_thread::sleep_for(timeout);
+}
@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "epoll_serial_port.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <modm/debug/logger.hpp>
+
+#undef MODM_LOG_LEVEL
+#define MODM_LOG_LEVEL 	modm::log::ERROR
+
+namespace
+{
+	speed_t
+	toSpeed(uint32_t baudrate)
+	{
+		switch (baudrate)
+		{
+			case 1'200: return B1200;
+			case 2'400: return B2400;
+			case 4'800: return B4800;
+			case 9'600: return B9600;
+			case 19'200: return B19200;
+			case 38'400: return B38400;
+			case 57'600: return B57600;
+			case 115'200: return B115200;
+			case 230'400: return B230400;
+			case 460'800: return B460800;
+			case 500'000: return B500000;
+			case 576'000: return B576000;
+			case 921'600: return B921600;
+			case 1'000'000: return B1000000;
+			case 1'152'000: return B1152000;
+			case 1'500'000: return B1500000;
+			case 2'000'000: return B2000000;
+			case 2'500'000: return B2500000;
+			case 3'000'000: return B3000000;
+			case 3'500'000: return B3500000;
+			case 4'000'000: return B4000000;
+			default: return B0;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+modm::platform::EpollSerialPort::~EpollSerialPort()
+{
+	close();
+}
+
+bool
+modm::platform::EpollSerialPort::open(const char* deviceName, uint32_t baudrate)
+{
+	close();
+
+	const speed_t speed = toSpeed(baudrate);
+	if (speed == B0) {
+		MODM_LOG_ERROR << MODM_FILE_INFO;
+		MODM_LOG_ERROR << "Unsupported baud rate " << baudrate << modm::endl;
+		return false;
+	}
+
+	fileDescriptor = ::open(deviceName, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+	if (fileDescriptor == -1) {
+		MODM_LOG_ERROR << MODM_FILE_INFO;
+		MODM_LOG_ERROR << "Could not open '" << deviceName << "': " << strerror(errno) << modm::endl;
+		return false;
+	}
+
+	struct termios configuration;
+	if (tcgetattr(fileDescriptor, &configuration) == -1)
+	{
+		MODM_LOG_ERROR << MODM_FILE_INFO;
+		MODM_LOG_ERROR << "'" << deviceName << "' is not a serial port: " << strerror(errno) << modm::endl;
+		close();
+		return false;
+	}
+	// raw 8N1 without flow control, reads return immediately
+	cfmakeraw(&configuration);
+	configuration.c_cflag |= CLOCAL | CREAD;
+	configuration.c_cflag &= ~(CSTOPB | CRTSCTS | HUPCL);
+	configuration.c_iflag &= ~(IXOFF | IXON | IXANY);
+	configuration.c_cc[VMIN] = 0;
+	configuration.c_cc[VTIME] = 0;
+	cfsetispeed(&configuration, speed);
+	cfsetospeed(&configuration, speed);
+	if (tcsetattr(fileDescriptor, TCSANOW, &configuration) == -1)
+	{
+		MODM_LOG_ERROR << MODM_FILE_INFO;
+		MODM_LOG_ERROR << "Could not configure '" << deviceName << "': " << strerror(errno) << modm::endl;
+		close();
+		return false;
+	}
+	tcflush(fileDescriptor, TCIOFLUSH);
+
+	epollDescriptor = epoll_create1(EPOLL_CLOEXEC);
+	struct epoll_event event{};
+	event.events = EPOLLIN;
+	if (epollDescriptor == -1 or
+		epoll_ctl(epollDescriptor, EPOLL_CTL_ADD, fileDescriptor, &event) == -1)
+	{
+		MODM_LOG_ERROR << MODM_FILE_INFO;
+		MODM_LOG_ERROR << "Could not create epoll instance: " << strerror(errno) << modm::endl;
+		close();
+		return false;
+	}
+	registeredEvents = EPOLLIN;
+	error = false;
+
+	return true;
+}
+
+void
+modm::platform::EpollSerialPort::close()
+{
+	if (epollDescriptor != -1) {
+		::close(epollDescriptor);
+		epollDescriptor = -1;
+	}
+	if (fileDescriptor != -1) {
+		::close(fileDescriptor);
+		fileDescriptor = -1;
+	}
+	rxQueue.pop(rxQueue.getSize());
+	txQueue.pop(txQueue.getSize());
+}
+
+// ----------------------------------------------------------------------------
+void
+modm::platform::EpollSerialPort::update()
+{
+	transmit();
+	receive();
+}
+
+bool
+modm::platform::EpollSerialPort::wait(std::chrono::milliseconds timeout)
+{
+	using namespace std::chrono;
+	const auto start = steady_clock::now();
+	update();
+	while (rxQueue.isEmpty() and isOpen() and not error)
+	{
+		int remaining = -1;
+		if (timeout.count() >= 0)
+		{
+			const auto elapsed = duration_cast<milliseconds>(steady_clock::now() - start);
+			remaining = int(std::clamp<milliseconds::rep>((timeout - elapsed).count(),
+														  0, std::numeric_limits<int>::max()));
+		}
+		// also wake up to transmit, but keep waiting for received data
+		const uint32_t events = txQueue.isEmpty() ? EPOLLIN : (EPOLLIN | EPOLLOUT);
+		if (not waitForEvents(events, remaining)) {
+			break;
+		}
+		update();
+	}
+	return rxQueue.isNotEmpty();
+}
+
+// ----------------------------------------------------------------------------
+void
+modm::platform::EpollSerialPort::write(char c)
+{
+	if (txQueue.isFull()) {
+		flush();
+	}
+	txQueue.push(static_cast<uint8_t>(c));
+}
+
+void
+modm::platform::EpollSerialPort::write(const char* str)
+{
+	writeBlocking({reinterpret_cast<const uint8_t*>(str), std::strlen(str)});
+}
+
+void
+modm::platform::EpollSerialPort::flush()
+{
+	transmit();
+	while (txQueue.isNotEmpty() and isOpen() and not error)
+	{
+		waitForEvents(EPOLLOUT, -1);
+		transmit();
+	}
+}
+
+bool
+modm::platform::EpollSerialPort::read(char& c)
+{
+	uint8_t data;
+	if (read({&data, 1}) == 0) {
+		return false;
+	}
+	c = static_cast<char>(data);
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+void
+modm::platform::EpollSerialPort::writeBlocking(std::span<const uint8_t> data)
+{
+	data = data.subspan(write(data));
+	while (not data.empty() and isOpen() and not error)
+	{
+		waitForEvents(EPOLLOUT, -1);
+		data = data.subspan(write(data));
+	}
+	flush();
+}
+
+void
+modm::platform::EpollSerialPort::flushWriteBuffer()
+{
+	flush();
+	if (isOpen()) {
+		tcdrain(fileDescriptor);
+	}
+}
+
+std::size_t
+modm::platform::EpollSerialPort::write(std::span<const uint8_t> data)
+{
+	if (not isOpen()) {
+		return 0;
+	}
+	std::size_t count = 0;
+	if (txQueue.isEmpty())
+	{
+		// nothing is buffered, so the data can be written directly
+		const ssize_t result = ::write(fileDescriptor, data.data(), data.size());
+		if (checkResult(result)) {
+			count = result;
+		}
+	}
+	count += txQueue.push(data.subspan(count));
+	if (count < data.size())
+	{
+		transmit();
+		count += txQueue.push(data.subspan(count));
+	}
+	return count;
+}
+
+bool
+modm::platform::EpollSerialPort::isWriteFinished()
+{
+	transmit();
+	int pending = 0;
+	if (isOpen() and ioctl(fileDescriptor, TIOCOUTQ, &pending) == -1) {
+		pending = 0;
+	}
+	return txQueue.isEmpty() and pending == 0;
+}
+
+std::size_t
+modm::platform::EpollSerialPort::read(std::span<uint8_t> data)
+{
+	transmit();
+	std::size_t count = rxQueue.pop(data);
+	if (count < data.size()) {
+		count += receive(data.subspan(count));
+	}
+	return count;
+}
+
+std::size_t
+modm::platform::EpollSerialPort::receiveBufferSize()
+{
+	update();
+	return rxQueue.getSize();
+}
+
+std::size_t
+modm::platform::EpollSerialPort::discardReceiveBuffer()
+{
+	const auto count = rxQueue.getSize();
+	rxQueue.pop(count);
+	if (isOpen()) {
+		tcflush(fileDescriptor, TCIFLUSH);
+	}
+	return count;
+}
+
+std::size_t
+modm::platform::EpollSerialPort::discardTransmitBuffer()
+{
+	const auto count = txQueue.getSize();
+	txQueue.pop(count);
+	if (isOpen()) {
+		tcflush(fileDescriptor, TCOFLUSH);
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+std::size_t
+modm::platform::EpollSerialPort::receive(std::span<uint8_t> direct)
+{
+	const auto regions = rxQueue.getWritableRegions();
+	if (not isOpen() or direct.size() + regions.size() == 0) {
+		return 0;
+	}
+	struct iovec vectors[3] = {
+		{direct.data(), direct.size()},
+		{regions.first.data(), regions.first.size()},
+		{regions.second.data(), regions.second.size()},
+	};
+	const ssize_t result = ::readv(fileDescriptor, vectors, 3);
+	if (not checkResult(result)) {
+		return 0;
+	}
+	const std::size_t count = std::min<std::size_t>(result, direct.size());
+	rxQueue.commit(result - count);
+	return count;
+}
+
+void
+modm::platform::EpollSerialPort::transmit()
+{
+	const auto regions = txQueue.getReadableRegions();
+	if (not isOpen() or regions.size() == 0) {
+		return;
+	}
+	struct iovec vectors[2] = {
+		{const_cast<uint8_t*>(regions.first.data()), regions.first.size()},
+		{const_cast<uint8_t*>(regions.second.data()), regions.second.size()},
+	};
+	const ssize_t result = ::writev(fileDescriptor, vectors, 2);
+	if (checkResult(result)) {
+		txQueue.pop(decltype(txQueue.getSize())(result));
+	}
+}
+
+bool
+modm::platform::EpollSerialPort::waitForEvents(uint32_t events, int timeout)
+{
+	if (not isOpen()) {
+		return false;
+	}
+	if (events != registeredEvents)
+	{
+		struct epoll_event event{};
+		event.events = events;
+		if (epoll_ctl(epollDescriptor, EPOLL_CTL_MOD, fileDescriptor, &event) == -1)
+		{
+			MODM_LOG_ERROR << MODM_FILE_INFO;
+			MODM_LOG_ERROR << "Could not wait for events: " << strerror(errno) << modm::endl;
+			error = true;
+			return false;
+		}
+		registeredEvents = events;
+	}
+	struct epoll_event event;
+	int result;
+	do {
+		result = epoll_wait(epollDescriptor, &event, 1, timeout);
+	}
+	while (result == -1 and errno == EINTR);
+
+	if (result == 1 and (event.events & (EPOLLERR | EPOLLHUP))) {
+		error = true;
+	}
+	return result == 1;
+}
+
+bool
+modm::platform::EpollSerialPort::checkResult(ssize_t result)
+{
+	if (result >= 0) {
+		return true;
+	}
+	if (errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR) {
+		error = true;
+	}
+	return false;
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_HOSTED_EPOLL_SERIAL_PORT_HPP
+#define MODM_HOSTED_EPOLL_SERIAL_PORT_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <modm/architecture/driver/atomic/queue.hpp>
+#include <modm/io/iodevice.hpp>
+
+namespace modm
+{
+
+namespace platform
+{
+
+/**
+ * Buffered serial port using non-blocking file descriptors and epoll.
+ *
+ * The port does not use a thread. All data is transferred by the calling
+ * thread in bulk: a read from an empty receive buffer reads everything the
+ * operating system has received with one system call, and a write passes the
+ * whole transmit buffer to the operating system at once. Bulk reads and
+ * writes bypass the buffers if possible. The buffers are part of the object,
+ * so no memory is allocated after construction.
+ *
+ * Single bytes written with `write(char)` stay in the transmit buffer until
+ * the buffer is full or until `flush()`, `update()`, `wait()` or a read is
+ * called. A main loop should call `update()` regularly or wait for data with
+ * `wait()` instead of polling.
+ *
+ * The port must only be used from one thread.
+ *
+ * @see		StaticEpollSerialPort for the `modm::Uart` interface
+ * @ingroup	modm_platform_uart
+ */
+class EpollSerialPort : public IODevice
+{
+public:
+	static constexpr std::size_t RxBufferSize = 32'767;
+	static constexpr std::size_t TxBufferSize = 32'767;
+
+	EpollSerialPort() = default;
+
+	~EpollSerialPort();
+
+	EpollSerialPort(const EpollSerialPort&) = delete;
+
+	EpollSerialPort&
+	operator = (const EpollSerialPort&) = delete;
+
+	/**
+	 * Opens the device in raw mode with 8N1 and without flow control.
+	 *
+	 * @param	baudrate
+	 * 		one of the standard baud rates between 1'200 and 4'000'000
+	 * @return	`false` if the device could not be opened or configured
+	 */
+	bool
+	open(const char* deviceName, uint32_t baudrate);
+
+	bool
+	isOpen() const
+	{ return fileDescriptor >= 0; }
+
+	/// Closes the device and discards the buffered data
+	void
+	close();
+
+	/// Transfers the buffered data without waiting
+	void
+	update();
+
+	/**
+	 * Waits until data is received or the timeout expires.
+	 *
+	 * Buffered data is transmitted while waiting.
+	 *
+	 * @param	timeout
+	 * 		negative to wait indefinitely
+	 * @return	`true` if received data is available
+	 */
+	bool
+	wait(std::chrono::milliseconds timeout);
+
+	/// File descriptor of the device, for example for an external event loop
+	int
+	getFileDescriptor() const
+	{ return fileDescriptor; }
+
+	// IODevice
+	using IODevice::write;
+
+	void
+	write(char c) override;
+
+	void
+	write(const char* str) override;
+
+	/// Waits until the transmit buffer is passed to the operating system
+	void
+	flush() override;
+
+	bool
+	read(char& c) override;
+
+	// Uart
+	/// Writes all data and waits until it is passed to the operating system
+	void
+	writeBlocking(std::span<const uint8_t> data);
+
+	/// Waits until all data is transmitted on the line
+	void
+	flushWriteBuffer();
+
+	/// @return	the number of bytes buffered or transmitted, maximal `data.size()`
+	std::size_t
+	write(std::span<const uint8_t> data);
+
+	/// @return	`true` if the buffer is empty and the last byte has been sent
+	bool
+	isWriteFinished();
+
+	/// @return	the number of bytes read, maximal `data.size()`
+	std::size_t
+	read(std::span<uint8_t> data);
+
+	/// @return	the number of received bytes in the buffer
+	std::size_t
+	receiveBufferSize();
+
+	/// @return	the number of bytes in the transmit buffer
+	std::size_t
+	transmitBufferSize() const
+	{ return txQueue.getSize(); }
+
+	/// Empties the receive buffer and the input queue of the operating system
+	std::size_t
+	discardReceiveBuffer();
+
+	/// Empties the transmit buffer and the output queue of the operating system
+	std::size_t
+	discardTransmitBuffer();
+
+	/// @return	`true` if a read or write failed or the device was disconnected
+	bool
+	hasError() const
+	{ return error; }
+
+	void
+	clearError()
+	{ error = false; }
+
+private:
+	// Reads into `direct` first and the remaining data into the receive
+	// buffer, returns the number of bytes read into `direct`.
+	std::size_t
+	receive(std::span<uint8_t> direct = {});
+
+	void
+	transmit();
+
+	bool
+	waitForEvents(uint32_t events, int timeout);
+
+	bool
+	checkResult(ssize_t result);
+
+	int fileDescriptor{-1};
+	int epollDescriptor{-1};
+	uint32_t registeredEvents{0};
+	bool error{false};
+
+	modm::atomic::Queue<uint8_t, RxBufferSize> rxQueue;
+	modm::atomic::Queue<uint8_t, TxBufferSize> txQueue;
+};
+
+}	// namespace platform
+
+}	// namespace modm
+
+#endif	// MODM_HOSTED_EPOLL_SERIAL_PORT_HPP
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_HOSTED_STATIC_EPOLL_SERIAL_PORT_HPP
+#define MODM_HOSTED_STATIC_EPOLL_SERIAL_PORT_HPP
+
+#include <modm/architecture/interface/uart.hpp>
+
+#include "epoll_serial_port.hpp"
+
+namespace modm
+{
+
+namespace platform
+{
+
+/**
+ * Wrapper with static methods for the EpollSerialPort class, so that it can
+ * be used wherever a `modm::Uart` is expected, for example by the AMNB, SAB
+ * and RPR interfaces.
+ *
+ * @warning Using the same type (equal template specialization number) will
+ *          generate a shared object!
+ *
+ * @ingroup	modm_platform_uart
+ */
+template<int N>
+class StaticEpollSerialPort : public modm::Uart
+{
+public:
+	static constexpr size_t RxBufferSize = EpollSerialPort::RxBufferSize;
+	static constexpr size_t TxBufferSize = EpollSerialPort::TxBufferSize;
+
+	/**
+	 * Opens the device with the baud rate.
+	 *
+	 * @tparam	baudrate
+	 *		desired baud rate in Hz
+	 */
+	template<baudrate_t baudrate>
+	static bool
+	initialize(EpollSerialPort& port, const char* deviceName)
+	{
+		backend = &port;
+		return backend->open(deviceName, baudrate);
+	}
+
+	static void
+	writeBlocking(uint8_t data)
+	{ backend->writeBlocking({&data, 1}); }
+
+	static void
+	writeBlocking(const uint8_t *data, std::size_t length)
+	{ backend->writeBlocking({data, length}); }
+
+	static void
+	flushWriteBuffer()
+	{ backend->flushWriteBuffer(); }
+
+	static bool
+	write(uint8_t data)
+	{ return backend->write({&data, 1}) == 1; }
+
+	static std::size_t
+	write(const uint8_t *data, std::size_t length)
+	{ return backend->write({data, length}); }
+
+	static bool
+	isWriteFinished()
+	{ return backend->isWriteFinished(); }
+
+	static bool
+	read(uint8_t &data)
+	{ return backend->read({&data, 1}) == 1; }
+
+	static std::size_t
+	read(uint8_t *data, std::size_t length)
+	{ return backend->read({data, length}); }
+
+	static std::size_t
+	receiveBufferSize()
+	{ return backend->receiveBufferSize(); }
+
+	static std::size_t
+	transmitBufferSize()
+	{ return backend->transmitBufferSize(); }
+
+	static std::size_t
+	discardReceiveBuffer()
+	{ return backend->discardReceiveBuffer(); }
+
+	static std::size_t
+	discardTransmitBuffer()
+	{ return backend->discardTransmitBuffer(); }
+
+	static bool
+	hasError()
+	{ return backend->hasError(); }
+
+	static void
+	clearError()
+	{ backend->clearError(); }
+
+private:
+	static inline EpollSerialPort* backend = nullptr;
+};
+
+}	// namespace platform
+
+}	// namespace modm
+
+#endif	// MODM_HOSTED_STATIC_EPOLL_SERIAL_PORT_HPP
@@ -104,8 +104,21 @@ public:
 	static std::size_t
 	write(const uint8_t *data, std::size_t length)
 	{
+		if (not length) return 0;
 		std::size_t count{0};
-		for (; count < length; ++count) if (not write(*data++)) break;
+		if (isWriteFinished())
+		{
+			Hal::write(*data);
+			count = 1;
+		}
+		if (const std::size_t pushed = txBuffer.push(std::span{data + count, length - count}); pushed)
+		{
+			count += pushed;
+			// Disable interrupts while enabling the transmit interrupt
+			atomic::Lock lock;
+			// Transmit Data Register Empty Interrupt Enable
+			Hal::enableInterrupt(Hal::Interrupt::TxEmpty);
+		}
 		return count;
 	}
 
@@ -126,12 +139,8 @@ public:
 			// disable interrupt since buffer will be cleared
 			Hal::disableInterrupt(Hal::Interrupt::TxEmpty);
 		}
-		std::size_t count{0};
-		while(not txBuffer.isEmpty())
-		{
-			++count;
-			txBuffer.pop();
-		}
+		const auto count = txBuffer.getSize();
+		txBuffer.pop(count);
 		return count;
 	}
 };
@@ -185,15 +194,7 @@ public:
 	static std::size_t
 	read(uint8_t *data, std::size_t length)
 	{
-		std::size_t count{0};
-		for (; count < length; ++count)
-		{
-			if (rxBuffer.isEmpty()) break;
-
-			*data++ = rxBuffer.get();
-			rxBuffer.pop();
-		}
-		return count;
+		return rxBuffer.pop(std::span{data, length});
 	}
 
 	static std::size_t
@@ -202,12 +203,8 @@ public:
 	static std::size_t
 	discardReceiveBuffer()
 	{
-		std::size_t count{0};
-		while(not rxBuffer.isEmpty())
-		{
-			++count;
-			rxBuffer.pop();
-		}
+		const auto count = rxBuffer.getSize();
+		rxBuffer.pop(count);
 		return count;
 	}
 };
@@ -113,7 +113,7 @@ modm_context_stack_usage(const modm_context_t *ctx)
 	return 0;
 }
 
-static modm_context_t main_context;
+static thread_local modm_context_t main_context;
 
 uintptr_t
 modm_context_start(modm_context_t *to)
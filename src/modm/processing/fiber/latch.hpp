@@ -12,6 +12,7 @@
 #pragma once
 
 #include <modm/architecture/interface/fiber.hpp>
+#include "wait_queue.hpp"
 #include <limits>
 #include <atomic>
 
@@ -28,6 +29,7 @@ class latch
 
 	using count_t = uint16_t;
 	std::atomic<count_t> count;
+	mutable WaitQueue waiters;
 
 public:
 	constexpr explicit
@@ -47,6 +49,11 @@ public:
 		do if (value == 0) return;
 		while (not count.compare_exchange_weak(value, value >= n ? value - n : 0,
 					std::memory_order_acquire, std::memory_order_relaxed));
+		if (value <= n)
+		{
+			modm::atomic::Lock _;
+			waiters.notify_all();
+		}
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -60,7 +67,7 @@ public:
 	void inline
 	wait() const
 	{
-		while(not try_wait()) modm::this_fiber::yield();
+		waiters.wait([this]{ return try_wait(); });
 	}
 
 	void inline
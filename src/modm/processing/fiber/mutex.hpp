@@ -18,6 +18,7 @@
 
 #include <modm/architecture/interface/fiber.hpp>
 #include <modm/architecture/interface/atomic_lock.hpp>
+#include "wait_queue.hpp"
 #include <limits>
 #include <atomic>
 #include <mutex>
@@ -29,6 +30,7 @@ namespace modm::fiber
 /// @{
 
 /// Implements the `std::mutex` interface for fibers.
+/// Blocked fibers wait in FIFO order and the lock is handed over directly.
 /// @see https://en.cppreference.com/w/cpp/thread/mutex
 class mutex
 {
@@ -36,6 +38,7 @@ class mutex
 	mutex& operator=(const mutex&) = delete;
 
 	std::atomic_bool locked{false};
+	WaitQueue waiters;
 public:
 	constexpr mutex() = default;
 
@@ -50,14 +53,16 @@ public:
 	void inline
 	lock()
 	{
-		while(not try_lock()) modm::this_fiber::yield();
+		if (not try_lock()) waiters.suspend_unless([this]{ return try_lock(); });
 	}
 
 	/// @note This function can be called from an interrupt.
 	void inline
 	unlock()
 	{
-		locked.store(false, std::memory_order_release);
+		modm::atomic::Lock _;
+		// the lock remains locked when handed over to the next fiber
+		if (not waiters.notify_one()) locked.store(false, std::memory_order_release);
 	}
 };
 
@@ -95,17 +100,12 @@ class recursive_mutex
 	volatile fiber::id owner{NoOwner};
 	static constexpr count_t countMax{count_t(-1)};
 	volatile count_t count{1};
+	WaitQueue waiters;
 
-public:
-	constexpr recursive_mutex() = default;
-
-	/// @note This function can be called from an interrupt.
-	[[nodiscard]]
+	// must be called inside an atomic lock
 	bool inline
-	try_lock()
+	try_lock(fiber::id id)
 	{
-		const auto id = modm::this_fiber::get_id();
-		modm::atomic::Lock _;
 		if (owner == NoOwner) {
 			owner = id;
 			// count = 1; is implicit
@@ -118,10 +118,24 @@ public:
 		return false;
 	}
 
+public:
+	constexpr recursive_mutex() = default;
+
+	/// @note This function can be called from an interrupt.
+	[[nodiscard]]
+	bool inline
+	try_lock()
+	{
+		const auto id = modm::this_fiber::get_id();
+		modm::atomic::Lock _;
+		return try_lock(id);
+	}
+
 	void inline
 	lock()
 	{
-		while(not try_lock()) modm::this_fiber::yield();
+		const auto id = modm::this_fiber::get_id();
+		waiters.wait([this, id]{ return try_lock(id); });
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -133,6 +147,7 @@ public:
 		else {
 			// count = 1; is implicit
 			owner = NoOwner;
+			waiters.notify_one();
 		}
 	}
 };
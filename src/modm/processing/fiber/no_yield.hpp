@@ -27,5 +27,21 @@ get_id()
 	return 0;
 }
 
+void inline
+detail::sleep(modm::chrono::milli_clock::duration sleep_duration)
+{
+	// block in-place
+	const auto start = modm::chrono::milli_clock::now();
+	while ((modm::chrono::milli_clock::now() - start) < sleep_duration) ;
+}
+
+void inline
+detail::sleep(modm::chrono::micro_clock::duration sleep_duration)
+{
+	// block in-place
+	const auto start = modm::chrono::micro_clock::now();
+	while ((modm::chrono::micro_clock::now() - start) < sleep_duration) ;
+}
+
 } // namespace modm::this_fiber
 /// @endcond
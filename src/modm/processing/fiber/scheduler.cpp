@@ -10,6 +10,7 @@
 // ----------------------------------------------------------------------------
 
 #include "scheduler.hpp"
+#include <modm/architecture/detect.hpp>
 
 /// @cond
 namespace modm::this_fiber
@@ -27,5 +28,25 @@ get_id()
 	return modm::fiber::Scheduler::instance().get_id();
 }
 
+void
+detail::sleep(modm::chrono::milli_clock::duration sleep_duration)
+{
+	modm::fiber::Scheduler::instance().sleep<modm::chrono::milli_clock>(sleep_duration);
+}
+
+void
+detail::sleep(modm::chrono::micro_clock::duration sleep_duration)
+{
+	modm::fiber::Scheduler::instance().sleep<modm::chrono::micro_clock>(sleep_duration);
+}
+
 } // namespace modm::this_fiber
+
+#ifndef MODM_OS_HOSTED
+// Busy-wait by default, the hosted platform sleeps instead
+modm_weak void
+modm::fiber::idle(std::chrono::microseconds)
+{
+}
+#endif
 /// @endcond
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <modm/architecture/interface/fiber.hpp>
+#include "wait_queue.hpp"
 #include <limits>
 #include <atomic>
 
@@ -22,6 +23,7 @@ namespace modm::fiber
 /// @{
 
 /// Implements the `std::counting_semaphore` interface for fibers.
+/// Blocked fibers wait in FIFO order and a release is handed over directly.
 /// @see https://en.cppreference.com/w/cpp/thread/counting_semaphore
 template< std::ptrdiff_t LeastMaxValue = 255 >
 class counting_semaphore
@@ -32,6 +34,7 @@ class counting_semaphore
 	static_assert(LeastMaxValue <= uint16_t(-1), "counting_semaphore uses a 16-bit counter!");
 	using count_t = std::conditional_t<(LeastMaxValue < 256), uint8_t, uint16_t>;
 	std::atomic<count_t> count{};
+	WaitQueue waiters;
 
 public:
 	constexpr explicit
@@ -57,14 +60,16 @@ public:
 	void inline
 	acquire()
 	{
-		while(not try_acquire()) modm::this_fiber::yield();
+		if (not try_acquire()) waiters.suspend_unless([this]{ return try_acquire(); });
 	}
 
 	/// @note This function can be called from an interrupt.
 	void inline
 	release()
 	{
-		count.fetch_add(1, std::memory_order_release);
+		modm::atomic::Lock _;
+		// the count is not incremented when handed over to the next fiber
+		if (not waiters.notify_one()) count.fetch_add(1, std::memory_order_release);
 	}
 
 	template< typename Rep, typename Period >
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <modm/architecture/interface/fiber.hpp>
+#include "wait_queue.hpp"
 #include <atomic>
 #include <shared_mutex>
 
@@ -31,6 +32,16 @@ class shared_mutex
 	static constexpr fiber::id NoOwner{fiber::id(-1)};
 	static constexpr fiber::id SharedOwner{fiber::id(-2)};
 	std::atomic<fiber::id> owner{NoOwner};
+	WaitQueue waiters;
+
+	void inline
+	release()
+	{
+		modm::atomic::Lock _;
+		owner.store(NoOwner, std::memory_order_release);
+		waiters.notify_all();
+	}
+
 public:
 	constexpr shared_mutex() = default;
 
@@ -48,14 +59,14 @@ public:
 	void inline
 	lock()
 	{
-		while(not try_lock()) modm::this_fiber::yield();
+		waiters.wait([this]{ return try_lock(); });
 	}
 
 	/// @note This function can be called from an interrupt.
 	void inline
 	unlock()
 	{
-		owner.store(NoOwner, std::memory_order_release);
+		release();
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -73,14 +84,14 @@ public:
 	void inline
 	lock_shared()
 	{
-		while(not try_lock_shared()) modm::this_fiber::yield();
+		waiters.wait([this]{ return try_lock_shared(); });
 	}
 
 	/// @note This function can be called from an interrupt.
 	void inline
 	unlock_shared()
 	{
-		owner.store(NoOwner, std::memory_order_release);
+		release();
 	}
 };
 
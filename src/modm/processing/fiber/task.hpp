@@ -13,6 +13,7 @@
 
 #include "context.h"
 #include "stack.hpp"
+#include "statistics.hpp"
 #include "stop_token.hpp"
 #include <modm/architecture/interface/fiber.hpp>
 #include <type_traits>
@@ -25,6 +26,7 @@ namespace fiber
 
 // forward declaration
 class Scheduler;
+class WaitQueue;
 
 /// The Fiber scheduling policy.
 /// @ingroup modm_processing_fiber
@@ -35,6 +37,12 @@ Start
 	Later,	// Manually add the fiber to a scheduler.
 };
 
+/// The Fiber priority. Fibers with a higher priority are always scheduled
+/// before fibers with a lower priority.
+/// @see `modm::fiber::Scheduler::Priorities`
+/// @ingroup modm_processing_fiber
+using Priority = uint8_t;
+
 /**
  * The fiber task connects the callable fiber object with the fiber context and
  * scheduler. It constructs the fiber function on the stack if necessary, and
@@ -57,6 +65,7 @@ class Task
 	Task(const Task&) = delete;
 	Task& operator=(const Task&) = delete;
 	friend class Scheduler;
+	friend class WaitQueue;
 
 	// Make sure that Task and Fiber use a callable constructor, otherwise they
 	// may get placed in the .data section including the whole stack!!!
@@ -64,13 +73,21 @@ class Task
 	Task* next;
 	Scheduler *scheduler{nullptr};
 	stop_state stop{};
+	// The sleep deadline is reached when `(now - sleep_start) >= sleep_duration`
+	uint32_t sleep_start;
+	uint32_t sleep_duration;
+	Priority prio;
+	[[no_unique_address]] Statistics stats{};
 
 public:
 	/// @param stack	A stack object that is *NOT* shared with other tasks.
 	/// @param closure	A callable object of signature `void()`.
 	/// @param start	When to start this task.
+	/// @param priority	Scheduling priority, must be less than
+	///					`modm::fiber::Scheduler::Priorities`.
 	template<size_t Size, class Callable>
-	Task(Stack<Size>& stack, Callable&& closure, Start start=Start::Now);
+	Task(Stack<Size>& stack, Callable&& closure, Start start=Start::Now,
+		 Priority priority=0);
 
 	inline
 	~Task()
@@ -147,7 +164,21 @@ public:
 	bool
 	start();
 
-	/// @returns if the fiber is attached to a scheduler.
+	/// @returns the scheduling priority of this fiber.
+	[[nodiscard]] Priority inline
+	priority() const
+	{
+		return prio;
+	}
+
+	/// @returns the runtime statistics of this fiber.
+	[[nodiscard]] inline const Statistics&
+	statistics() const
+	{
+		return stats;
+	}
+
+	/// @returns if the fiber is attached to a scheduler, also while sleeping.
 	[[nodiscard]] bool inline
 	isRunning() const
 	{
@@ -178,8 +209,8 @@ class Fiber : public fiber::Task
 	fiber::Stack<StackSize> stack;
 public:
 	template<class T>
-	Fiber(T&& task, fiber::Start start=fiber::Start::Now)
-	: Task(stack, std::forward<T>(task), start)
+	Fiber(T&& task, fiber::Start start=fiber::Start::Now, fiber::Priority priority=0)
+	: Task(stack, std::forward<T>(task), start, priority)
 	{}
 };
 
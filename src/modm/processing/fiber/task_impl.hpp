@@ -19,7 +19,8 @@ namespace modm::fiber
 {
 
 template<size_t Size, class T>
-Task::Task(Stack<Size>& stack, T&& closure, Start start)
+Task::Task(Stack<Size>& stack, T&& closure, Start start, Priority priority)
+: prio(priority)
 {
 	constexpr bool with_stop_token = std::is_invocable_r_v<void, T, stop_token>;
 	if constexpr (std::is_convertible_v<T, void(*)()> or
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "scheduler.hpp"
+#include <modm/architecture/interface/atomic_lock.hpp>
+
+namespace modm::fiber
+{
+
+/**
+ * Intrusive FIFO queue of fibers that are blocked on a synchronization
+ * primitive. Blocked fibers are removed from the scheduler until they are
+ * notified, so they do not consume any context switches while waiting.
+ *
+ * The condition passed to `suspend_unless()` and `wait()` is evaluated inside
+ * a `modm::atomic::Lock`, so that a notification cannot get lost between
+ * checking the condition and suspending the fiber. The `notify_*()` functions
+ * must therefore also be called inside a `modm::atomic::Lock`:
+ *
+ * ```cpp
+ * modm::atomic::Lock _;
+ * flag = true;
+ * queue.notify_all();
+ * ```
+ *
+ * @note The condition must not acquire a `modm::atomic::Lock` itself.
+ * @ingroup modm_processing_fiber
+ */
+class WaitQueue
+{
+	WaitQueue(const WaitQueue&) = delete;
+	WaitQueue& operator=(const WaitQueue&) = delete;
+
+	Task* head{nullptr};
+	Task* tail{nullptr};
+
+public:
+	constexpr WaitQueue() = default;
+
+	/// @returns if no fiber is waiting in this queue.
+	[[nodiscard]] bool inline
+	empty() const
+	{
+		return head == nullptr;
+	}
+
+	/**
+	 * Suspends the current fiber until it is notified, unless `bool condition()`
+	 * returns true. Outside of a fiber context, this busy-waits on the condition.
+	 *
+	 * @returns `true` if the fiber was suspended and then notified, `false` if
+	 *          the condition was met.
+	 */
+	template< class Condition >
+	bool
+	suspend_unless(Condition&& condition)
+	{
+		auto& scheduler = Scheduler::instance();
+		if (scheduler.current == nullptr or Scheduler::isInsideInterrupt())
+		{
+			while(true)
+			{
+				modm::atomic::Lock _;
+				if (std::forward<Condition>(condition)()) return false;
+			}
+		}
+		{
+			modm::atomic::Lock _;
+			if (std::forward<Condition>(condition)()) return false;
+			Task* task = scheduler.suspend();
+			task->next = nullptr;
+			if (head) tail->next = task;
+			else head = task;
+			tail = task;
+		}
+		scheduler.resume();
+		return true;
+	}
+
+	/// Suspends the current fiber until `bool condition()` returns true. The
+	/// condition is evaluated again every time the fiber is notified.
+	template< class Condition >
+	void
+	wait(Condition&& condition)
+	{
+		while(suspend_unless(condition)) ;
+	}
+
+	/// Resumes the longest waiting fiber.
+	/// @warning Must be called inside a `modm::atomic::Lock`.
+	/// @note This function can be called from an interrupt.
+	/// @returns the resumed fiber or `nullptr` if the queue was empty.
+	Task*
+	notify_one()
+	{
+		Task* task = head;
+		if (task)
+		{
+			head = task->next;
+			Scheduler::notify(task);
+		}
+		return task;
+	}
+
+	/// Resumes all waiting fibers in FIFO order.
+	/// @warning Must be called inside a `modm::atomic::Lock`.
+	/// @note This function can be called from an interrupt.
+	/// @returns if any fiber was resumed.
+	bool
+	notify_all()
+	{
+		const bool notified = head;
+		while(notify_one()) ;
+		return notified;
+	}
+};
+
+} // namespace modm::fiber
@@ -14,22 +14,38 @@
 #define MODM_STDLIB_QUEUE_HPP
 
 #include <stdint.h>
-#include <deque>
-
+#include <atomic>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <type_traits>
 
 namespace modm
 {
 	namespace rtos
 	{
 		/**
-		 * Thread-safe Queue.
+		 * Thread-safe bounded Queue.
+		 *
+		 * All items are preallocated when the queue is created. Appended
+		 * items are stored in a lock-free multi-producer multi-consumer
+		 * ring buffer and prepended items in a lock-free stack, which is
+		 * emptied before the ring buffer. Like with FreeRTOS, items are
+		 * copied into and out of the queue.
+		 *
+		 * A thread only locks a mutex to wait on a condition variable when
+		 * the queue is empty or full and the timeout is not zero. The
+		 * other side only notifies the condition variable if a thread is
+		 * waiting, so that the fast path does not call the kernel.
 		 *
 		 * \ingroup	modm_processing_rtos
 		 */
 		template<typename T>
 		class Queue
 		{
+			static_assert(std::is_trivially_copyable_v<T>,
+					"The items are copied and must be trivially copyable!");
+
 		public:
 			/**
 			 * Create a Queue.
@@ -39,24 +55,56 @@ namespace modm
 			 */
 			Queue(uint32_t length);
 
-			~Queue();
+			~Queue() = default;
 
 			/**
-			 * Get the number of items stored in the queue
+			 * Get the number of items stored in the queue, including
+			 * items which are currently being appended or removed.
 			 */
 			std::size_t
 			getSize() const;
 
+			/**
+			 * Post an item to the back of the queue.
+			 *
+			 * \param timeout
+			 * 			Time in milliseconds to wait for space in the queue,
+			 * 			-1 waits forever.
+			 * \return	`false` if the queue was still full after the timeout.
+			 */
 			bool
 			append(const T& item, uint32_t timeout = -1);
 
+			/**
+			 * Post an item to the front of the queue.
+			 *
+			 * \param timeout
+			 * 			Time in milliseconds to wait for space in the queue,
+			 * 			-1 waits forever.
+			 * \return	`false` if the queue was still full after the timeout.
+			 */
 			bool
 			prepend(const T& item, uint32_t timeout = -1);
 
-
+			/**
+			 * Copy the item at the front of the queue without removing it.
+			 *
+			 * \param timeout
+			 * 			Time in milliseconds to wait for an item, -1 waits
+			 * 			forever.
+			 * \return	`false` if the queue was still empty after the timeout.
+			 */
 			bool
 			peek(T& item, uint32_t timeout = -1) const;
 
+			/**
+			 * Remove the item at the front of the queue.
+			 *
+			 * \param timeout
+			 * 			Time in milliseconds to wait for an item, -1 waits
+			 * 			forever.
+			 * \return	`false` if the queue was still empty after the timeout.
+			 */
 			bool
 			get(T& item, uint32_t timeout = -1);
 
@@ -78,12 +126,73 @@ namespace modm
 			Queue&
 			operator = (const Queue& other);
 
-			mutable std::timed_mutex mutex;
+			bool
+			tryAppend(const T& item);
+
+			bool
+			tryPrepend(const T& item);
+
+			bool
+			tryPeek(T& item) const;
+
+			bool
+			tryGet(T& item);
 
-			uint32_t maxSize;
-			std::deque<T> deque;
+			bool
+			reserve();
+
+			template<typename Function>
+			bool
+			wait(std::condition_variable& condition, uint32_t timeout,
+				 Function&& attempt) const;
+
+			void
+			notify(std::condition_variable& condition) const;
+
+			uint32_t
+			popNode(std::atomic<uint64_t>& stack) const;
+
+			void
+			pushNode(std::atomic<uint64_t>& stack, uint32_t index) const;
+
+			static constexpr uint32_t None = uint32_t(-1);
+			static constexpr std::size_t CacheLineSize = 64;
+
+			struct Cell
+			{
+				std::atomic<uint32_t> sequence;
+				T value;
+			};
+
+			struct Node
+			{
+				std::atomic<uint32_t> next;
+				T value;
+			};
+
+			const uint32_t maxSize;
+			const uint32_t mask;
+			const std::unique_ptr<Cell[]> cells;
+			const std::unique_ptr<Node[]> nodes;
+
+			// number of stored items including the ones in transit
+			alignas(CacheLineSize) std::atomic<uint32_t> size{0};
+			// ring buffer of appended items
+			alignas(CacheLineSize) std::atomic<uint32_t> head{0};
+			alignas(CacheLineSize) std::atomic<uint32_t> tail{0};
+			// stacks of prepended items and unused nodes: tag << 32 | index
+			alignas(CacheLineSize) std::atomic<uint64_t> front;
+			std::atomic<uint64_t> unused;
+
+			// only used to block when the queue is empty or full
+			alignas(CacheLineSize) mutable std::atomic<uint32_t> waiting{0};
+			mutable std::mutex mutex;
+			mutable std::condition_variable notEmpty;
+			mutable std::condition_variable notFull;
 		};
 	}
 }
 
+#include "queue_impl.hpp"
+
 #endif // MODM_STDLIB_QUEUE_HPP
@@ -15,117 +15,329 @@
 #	error "Don't use this file directly, use 'queue.hpp' instead!"
 #endif
 
+#include <algorithm>
+#include <bit>
 #include <chrono>
+#include <cstring>
+#include <thread>
 
 template <typename T>
 modm::rtos::Queue<T>::Queue(uint32_t length) :
-	maxSize(length)
+	maxSize(length), mask(std::bit_ceil(std::max(length, uint32_t(1))) - 1),
+	cells(new Cell[mask + 1]), nodes(new Node[length]),
+	front(None), unused(length ? 0 : None)
 {
+	// A cell at index i is free for the producer at position i
+	for (uint32_t ii = 0; ii <= mask; ++ii) {
+		cells[ii].sequence.store(ii, std::memory_order_relaxed);
+	}
+	for (uint32_t ii = 0; ii < length; ++ii) {
+		nodes[ii].next.store(ii + 1 < length ? ii + 1 : None, std::memory_order_relaxed);
+	}
 }
 
 template <typename T>
-modm::rtos::Queue<T>::~Queue()
+std::size_t
+modm::rtos::Queue<T>::getSize() const
 {
+	return size.load(std::memory_order_relaxed);
 }
 
 template <typename T>
-std::size_t
-modm::rtos::Queue<T>::getSize() const
+bool
+modm::rtos::Queue<T>::append(const T& item, uint32_t timeout)
 {
-	std::lock_guard<std::timed_mutex> lock(mutex);
-	deque.size();
+	if (wait(notFull, timeout, [&] { return tryAppend(item); })) {
+		notify(notEmpty);
+		return true;
+	}
+	return false;
 }
 
 template <typename T>
 bool
-modm::rtos::Queue<T>::append(const T& item, uint32_t timeout = -1)
+modm::rtos::Queue<T>::prepend(const T& item, uint32_t timeout)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout)) ||
-			deque.size() >= maxSize) {
-		return false;
+	if (wait(notFull, timeout, [&] { return tryPrepend(item); })) {
+		notify(notEmpty);
+		return true;
 	}
+	return false;
+}
 
-	deque.push_back(item);
-	mutex.unlock();
+// ----------------------------------------------------------------------------
+template <typename T>
+bool
+modm::rtos::Queue<T>::peek(T& item, uint32_t timeout) const
+{
+	return wait(notEmpty, timeout, [&] { return tryPeek(item); });
 }
 
 template <typename T>
 bool
-modm::rtos::Queue<T>::prepend(const T& item, uint32_t timeout = -1)
+modm::rtos::Queue<T>::get(T& item, uint32_t timeout)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
-		return false;
+	if (wait(notEmpty, timeout, [&] { return tryGet(item); })) {
+		notify(notFull);
+		return true;
 	}
+	return false;
+}
 
-	if (deque.empty()) {
-		mutex.unlock();
-		return false;
-	}
+// ----------------------------------------------------------------------------
+template <typename T>
+inline bool
+modm::rtos::Queue<T>::appendFromInterrupt(const T& item)
+{
+	return append(item, 0);
+}
 
-	deque.push_front(item);
-	mutex.unlock();
+template <typename T>
+inline bool
+modm::rtos::Queue<T>::prependFromInterrupt(const T& item)
+{
+	return prepend(item, 0);
+}
 
-	return false;
+template <typename T>
+inline bool
+modm::rtos::Queue<T>::getFromInterrupt(T& item)
+{
+	return get(item, 0);
 }
 
 // ----------------------------------------------------------------------------
 template <typename T>
 bool
-modm::rtos::Queue<T>::peek(T& item, uint32_t timeout = -1) const
+modm::rtos::Queue<T>::reserve()
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
-		return false;
+	uint32_t count = size.load(std::memory_order_relaxed);
+	do {
+		if (count >= maxSize) {
+			return false;
+		}
 	}
+	while (not size.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+	return true;
+}
 
-	if (deque.empty()) {
-		mutex.unlock();
+template <typename T>
+bool
+modm::rtos::Queue<T>::tryAppend(const T& item)
+{
+	if (not reserve()) {
 		return false;
 	}
 
-	item = deque.front();
+	uint32_t position = head.load(std::memory_order_relaxed);
+	Cell* cell;
+	while (true)
+	{
+		cell = &cells[position & mask];
+		const uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+		const int32_t difference = int32_t(sequence - position);
+		if (difference == 0)
+		{
+			if (head.compare_exchange_weak(position, position + 1,
+										   std::memory_order_relaxed)) {
+				break;
+			}
+		}
+		else
+		{
+			// The space is reserved, so the previous item in this cell is
+			// currently being read by another thread and is freed shortly.
+			if (difference < 0) {
+				std::this_thread::yield();
+			}
+			position = head.load(std::memory_order_relaxed);
+		}
+	}
 
-	mutex.unlock();
+	cell->value = item;
+	cell->sequence.store(position + 1, std::memory_order_release);
 	return true;
 }
 
 template <typename T>
 bool
-modm::rtos::Queue<T>::get(T& item, uint32_t timeout = -1)
+modm::rtos::Queue<T>::tryPrepend(const T& item)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
+	if (not reserve()) {
 		return false;
 	}
 
-	if (deque.empty()) {
-		mutex.unlock();
-		return false;
+	// The space is reserved and there are as many nodes as items, but a node
+	// may not have been returned by a consumer yet.
+	uint32_t index;
+	while ((index = popNode(unused)) == None) {
+		std::this_thread::yield();
 	}
 
-	item = deque.front();
-	deque.pop_front();
+	nodes[index].value = item;
+	pushNode(front, index);
+	return true;
+}
 
-	mutex.unlock();
+template <typename T>
+bool
+modm::rtos::Queue<T>::tryPeek(T& item) const
+{
+	// The item is copied optimistically and only used if it was not removed
+	// from the queue while copying.
+	T copy;
+	while (true)
+	{
+		const uint64_t top = front.load(std::memory_order_acquire);
+		if (uint32_t(top) != None)
+		{
+			std::memcpy(static_cast<void*>(&copy), &nodes[uint32_t(top)].value, sizeof(T));
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (front.load(std::memory_order_relaxed) == top) {
+				break;
+			}
+			continue;
+		}
+
+		const uint32_t position = tail.load(std::memory_order_acquire);
+		const Cell& cell = cells[position & mask];
+		const uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+		if (sequence != position + 1)
+		{
+			if (tail.load(std::memory_order_relaxed) == position) {
+				return false;
+			}
+			continue;
+		}
+		std::memcpy(static_cast<void*>(&copy), &cell.value, sizeof(T));
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (cell.sequence.load(std::memory_order_relaxed) == sequence) {
+			break;
+		}
+	}
+	item = copy;
+	return true;
+}
+
+template <typename T>
+bool
+modm::rtos::Queue<T>::tryGet(T& item)
+{
+	// Prepended items are removed first
+	if (const uint32_t index = popNode(front); index != None)
+	{
+		item = nodes[index].value;
+		pushNode(unused, index);
+		size.fetch_sub(1, std::memory_order_release);
+		return true;
+	}
+
+	uint32_t position = tail.load(std::memory_order_relaxed);
+	Cell* cell;
+	while (true)
+	{
+		cell = &cells[position & mask];
+		const uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+		const int32_t difference = int32_t(sequence - (position + 1));
+		if (difference == 0)
+		{
+			if (tail.compare_exchange_weak(position, position + 1,
+										   std::memory_order_relaxed)) {
+				break;
+			}
+		}
+		else if (difference < 0) {
+			// empty or the item is still being written
+			return false;
+		}
+		else {
+			position = tail.load(std::memory_order_relaxed);
+		}
+	}
+
+	item = cell->value;
+	cell->sequence.store(position + mask + 1, std::memory_order_release);
+	size.fetch_sub(1, std::memory_order_release);
 	return true;
 }
 
 // ----------------------------------------------------------------------------
 template <typename T>
-inline bool
-modm::rtos::Queue<T>::appendFromInterrupt(const T& item)
+uint32_t
+modm::rtos::Queue<T>::popNode(std::atomic<uint64_t>& stack) const
 {
-	return append(item);
+	// The tag is incremented on every change to prevent the ABA problem
+	uint64_t top = stack.load(std::memory_order_acquire);
+	while (uint32_t(top) != None)
+	{
+		const uint32_t next = nodes[uint32_t(top)].next.load(std::memory_order_relaxed);
+		const uint64_t tag = (top >> 32) + 1;
+		if (stack.compare_exchange_weak(top, (tag << 32) | next,
+										std::memory_order_acquire)) {
+			break;
+		}
+	}
+	return uint32_t(top);
 }
 
 template <typename T>
-inline bool
-modm::rtos::Queue<T>::prependFromInterrupt(const T& item)
+void
+modm::rtos::Queue<T>::pushNode(std::atomic<uint64_t>& stack, uint32_t index) const
 {
-	return prepend(item);
+	uint64_t top = stack.load(std::memory_order_relaxed);
+	do {
+		nodes[index].next.store(uint32_t(top), std::memory_order_relaxed);
+	}
+	while (not stack.compare_exchange_weak(top, (((top >> 32) + 1) << 32) | index,
+										   std::memory_order_release,
+										   std::memory_order_relaxed));
 }
 
+// ----------------------------------------------------------------------------
 template <typename T>
-inline bool
-modm::rtos::Queue<T>::getFromInterrupt(T& item)
+template <typename Function>
+bool
+modm::rtos::Queue<T>::wait(std::condition_variable& condition, uint32_t timeout,
+						   Function&& attempt) const
 {
-	return get(item);
+	if (attempt()) {
+		return true;
+	}
+	if (timeout == 0) {
+		return false;
+	}
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+	std::unique_lock<std::mutex> lock(mutex);
+	// Announce this thread before trying again, so that either the attempt
+	// succeeds or the other side sees the waiting thread and notifies it.
+	waiting.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	bool success;
+	while (not (success = attempt()))
+	{
+		if (timeout == uint32_t(-1)) {
+			condition.wait(lock);
+		}
+		else if (condition.wait_until(lock, deadline) == std::cv_status::timeout) {
+			success = attempt();
+			break;
+		}
+	}
+
+	waiting.fetch_sub(1, std::memory_order_relaxed);
+	return success;
+}
+
+template <typename T>
+void
+modm::rtos::Queue<T>::notify(std::condition_variable& condition) const
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (waiting.load(std::memory_order_relaxed))
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		condition.notify_all();
+	}
 }
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace modm
+{
+
+/**
+ * Ring buffer of the last recorded events, which overwrites the oldest event
+ * when it is full. Only a single writer may record events, which is not
+ * synchronized with the readers, therefore the buffer should be read from
+ * the context of the writer or while the program is halted by a debugger.
+ *
+ * The debugger can read the buffer via the members `events` and `head`:
+ * the newest event is at `events[(head - 1) % Capacity]`.
+ *
+ * \tparam	Event		Type of the recorded events
+ * \tparam	Capacity	Number of events, must be a power of two
+ *
+ * @ingroup modm_utils
+ */
+template<typename Event, std::size_t Capacity_>
+class TraceBuffer
+{
+public:
+	static constexpr std::size_t Capacity = Capacity_;
+	static_assert(Capacity and (Capacity & (Capacity - 1)) == 0,
+				  "Trace size must be a power of two!");
+
+	/// @returns the number of events in the buffer.
+	std::size_t inline
+	size() const
+	{
+		return head < Capacity ? head : Capacity;
+	}
+
+	/// @returns the total number of recorded events, including overwritten ones.
+	uint32_t inline
+	recorded() const
+	{
+		return head;
+	}
+
+	/// @returns the event at the index, with 0 being the oldest event.
+	inline const Event&
+	operator[](std::size_t index) const
+	{
+		return events[(head - size() + index) & (Capacity - 1)];
+	}
+
+	/// Records an event, overwriting the oldest event if the buffer is full.
+	void inline
+	record(const Event& event)
+	{
+		events[head & (Capacity - 1)] = event;
+		head = head + 1;
+	}
+
+	/// Removes all events.
+	void inline
+	clear()
+	{
+		head = 0;
+	}
+
+private:
+	Event events[Capacity]{};
+	volatile uint32_t head{0};
+};
+
+}	// namespace modm
@@ -18,3 +18,4 @@
 #include "utils/aligned_storage.hpp"
 #include "utils/inplace_any.hpp"
 #include "utils/inplace_function.hpp"
+#include "utils/trace_buffer.hpp"
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <benchmark/harness.hpp>
+#include <modm/processing/fiber.hpp>
+#include <modm/processing/fiber/mutex.hpp>
+#include <modm/processing/fiber/semaphore.hpp>
+#include <modm/processing/fiber/condition_variable.hpp>
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <utility>
+
+using modm::fiber::Start;
+using modm::this_fiber::yield;
+
+// The fibers are restarted for every run and access the state of the
+// currently running benchmark through these variables.
+static benchmark::State* running;
+static bool done;
+
+/// Runs the scheduler with the measured fiber and the additional fibers until
+/// the measured fiber is done.
+template< class... Fibers >
+static void
+run(benchmark::State& current, modm::Fiber<>& measured, Fibers&... fibers)
+{
+	running = &current;
+	done = false;
+	measured.start();
+	(fibers.start(), ...);
+	modm::fiber::Scheduler::run();
+}
+
+// ============================== CONTEXT SWITCH ==============================
+static constexpr size_t StackWords = modm::fiber::StackSizeDefault / sizeof(uintptr_t);
+alignas(modm::fiber::StackAlignment) static uintptr_t stack1[StackWords], stack2[StackWords];
+static modm_context_t ctx1, ctx2;
+
+// One iteration consists of two context switches
+MODM_BENCHMARK(context_jump)
+{
+	running = &state;
+	modm_context_init(&ctx1, stack1, stack1 + StackWords, (uintptr_t) +[](uintptr_t)
+	{
+		for (auto _ : *running) modm_context_jump(&ctx1, &ctx2);
+		modm_context_end(0);
+	}, 0);
+	modm_context_init(&ctx2, stack2, stack2 + StackWords, (uintptr_t) +[](uintptr_t)
+	{
+		while(true) modm_context_jump(&ctx2, &ctx1);
+	}, 0);
+	modm_context_reset(&ctx1);
+	modm_context_reset(&ctx2);
+	modm_context_start(&ctx1);
+}
+
+// ================================== YIELD ===================================
+static modm::Fiber<> yielding([]
+{
+	for (auto _ : *running) yield();
+	done = true;
+}, Start::Later);
+
+static void
+idleLoop()
+{
+	while(not done) yield();
+}
+
+// The idle fibers only yield and need less than the default stack
+using IdleFiber = modm::Fiber<std::min<size_t>(modm::fiber::StackSizeDefault, 2048)>;
+
+template< size_t... Index >
+static std::array<IdleFiber, sizeof...(Index)>
+makeIdling(std::index_sequence<Index...>)
+{
+	return {IdleFiber{((void) Index, idleLoop), Start::Later}...};
+}
+static auto idling = makeIdling(std::make_index_sequence<63>());
+
+/// Runs the yielding fiber with `fibers - 1` idle fibers.
+static void
+runYield(benchmark::State& current, size_t fibers)
+{
+	for (size_t ii = 0; ii < fibers - 1; ii++) idling[ii].start();
+	run(current, yielding);
+}
+
+// One iteration consists of as many context switches as there are fibers
+MODM_BENCHMARK(fiber_yield_1)
+{
+	runYield(state, 1);
+}
+
+MODM_BENCHMARK(fiber_yield_2)
+{
+	runYield(state, 2);
+}
+
+MODM_BENCHMARK(fiber_yield_4)
+{
+	runYield(state, 4);
+}
+
+MODM_BENCHMARK(fiber_yield_8)
+{
+	runYield(state, 8);
+}
+
+MODM_BENCHMARK(fiber_yield_64)
+{
+	runYield(state, 64);
+}
+
+// ================================== MUTEX ===================================
+static modm::fiber::mutex mtx;
+
+// The other fiber blocks on the mutex and gets it handed over
+static modm::Fiber<> mutexLocking([]
+{
+	for (auto _ : *running)
+	{
+		mtx.lock();
+		yield();
+		mtx.unlock();
+	}
+	done = true;
+}, Start::Later);
+
+static modm::Fiber<> mutexContending([]
+{
+	while(not done)
+	{
+		mtx.lock();
+		yield();
+		mtx.unlock();
+	}
+}, Start::Later);
+
+MODM_BENCHMARK(mutex_handoff)
+{
+	run(state, mutexLocking, mutexContending);
+}
+
+// ================================ SEMAPHORE =================================
+static modm::fiber::binary_semaphore ping{0}, pong{0};
+
+static modm::Fiber<> semaphorePing([]
+{
+	for (auto _ : *running)
+	{
+		ping.release();
+		pong.acquire();
+	}
+	done = true;
+	ping.release();
+}, Start::Later);
+
+static modm::Fiber<> semaphorePong([]
+{
+	while(true)
+	{
+		ping.acquire();
+		if (done) break;
+		pong.release();
+	}
+}, Start::Later);
+
+MODM_BENCHMARK(semaphore_pingpong)
+{
+	run(state, semaphorePing, semaphorePong);
+}
+
+// ============================ CONDITION VARIABLE ============================
+static modm::fiber::condition_variable cv;
+static bool turn;
+
+static modm::Fiber<> conditionPing([]
+{
+	for (auto _ : *running)
+	{
+		std::unique_lock lock{mtx};
+		cv.wait(lock, [] { return not turn; });
+		turn = true;
+		cv.notify_one();
+	}
+	std::unique_lock lock{mtx};
+	done = true;
+	cv.notify_one();
+}, Start::Later);
+
+static modm::Fiber<> conditionPong([]
+{
+	while(true)
+	{
+		std::unique_lock lock{mtx};
+		cv.wait(lock, [] { return turn or done; });
+		if (not turn) break;
+		turn = false;
+		cv.notify_one();
+	}
+}, Start::Later);
+
+MODM_BENCHMARK(condition_variable_pingpong)
+{
+	turn = false;
+	run(state, conditionPing, conditionPong);
+}
+
+// ================================ STACK USAGE ===============================
+MODM_BENCHMARK(stack_watermark)
+{
+	for (auto _ : state) yielding.stack_watermark();
+}
+
+MODM_BENCHMARK(stack_usage)
+{
+	yielding.stack_watermark();
+	for (auto _ : state) benchmark::doNotOptimize(yielding.stack_usage());
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/board.hpp>
+
+#include <benchmark/harness.hpp>
+#include <benchmark/reporter.hpp>
+
+using namespace modm::platform;
+
+// Reuse logger from board
+extern Board::LoggerDevice loggerDevice;
+namespace benchmark
+{
+	Reporter reporter(loggerDevice);
+}
+
+int
+main()
+{
+	Board::initialize();
+	Board::Leds::setOutput(modm::Gpio::Low);
+	Board::Leds::write(0b100);
+
+	MODM_LOG_INFO << "Benchmarks (" __DATE__ ", " __TIME__")\n";
+
+	Board::Leds::write(0b110);
+
+	run_modm_benchmark();
+
+	Board::Leds::write(0b111);
+	for (;;) {}
+}
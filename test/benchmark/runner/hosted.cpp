@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <benchmark/harness.hpp>
+#include <benchmark/reporter.hpp>
+
+#include <modm/platform.hpp>
+#include <modm/driver/io/terminal.hpp>
+
+modm::Terminal outputDevice;
+namespace benchmark
+{
+	Reporter reporter(outputDevice);
+}
+
+int main()
+{
+	return run_modm_benchmark();
+}
@@ -51,3 +51,70 @@ AtomicQueueTest::testQueue()
 
 	TEST_ASSERT_TRUE(queue.isEmpty());
 }
+
+void
+AtomicQueueTest::testBulk()
+{
+	modm::atomic::Queue<uint8_t, 5> queue;
+	const uint8_t input[] = {1, 2, 3, 4, 5, 6, 7};
+	uint8_t output[7]{};
+
+	TEST_ASSERT_EQUALS(queue.push(std::span{input, 3}), 3);
+	TEST_ASSERT_EQUALS(queue.getSize(), 3);
+
+	TEST_ASSERT_EQUALS(queue.pop(std::span{output, 2}), 2);
+	TEST_ASSERT_EQUALS(output[0], 1);
+	TEST_ASSERT_EQUALS(output[1], 2);
+
+	// wraps around the end of the buffer and stops when full
+	TEST_ASSERT_EQUALS(queue.push(std::span{input + 3, 4}), 4);
+	TEST_ASSERT_TRUE(queue.isFull());
+	TEST_ASSERT_EQUALS(queue.push(std::span{input, 1}), 0);
+
+	TEST_ASSERT_EQUALS(queue.pop(std::span{output}), 5);
+	const uint8_t expected[] = {3, 4, 5, 6, 7};
+	TEST_ASSERT_EQUALS_ARRAY(output, expected, 5);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.pop(std::span{output}), 0);
+}
+
+void
+AtomicQueueTest::testRegions()
+{
+	modm::atomic::Queue<uint8_t, 5> queue;
+
+	auto writable = queue.getWritableRegions();
+	TEST_ASSERT_EQUALS(writable.size(), 5u);
+	TEST_ASSERT_EQUALS(writable.first.size(), 5u);
+	TEST_ASSERT_EQUALS(queue.getReadableRegions().size(), 0u);
+
+	// move head and tail towards the end of the buffer
+	for (uint8_t ii = 0; ii < 4; ii++) queue.push(ii);
+	queue.pop(4);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+
+	writable = queue.getWritableRegions();
+	TEST_ASSERT_EQUALS(writable.first.size(), 2u);
+	TEST_ASSERT_EQUALS(writable.second.size(), 3u);
+	for (uint8_t ii = 0; ii < 2; ii++) writable.first[ii] = 10 + ii;
+	writable.second[0] = 12;
+	queue.commit(3);
+	TEST_ASSERT_EQUALS(queue.getSize(), 3);
+	TEST_ASSERT_EQUALS(queue.getWritableRegions().size(), 2u);
+
+	auto readable = queue.getReadableRegions();
+	TEST_ASSERT_EQUALS(readable.first.size(), 2u);
+	TEST_ASSERT_EQUALS(readable.second.size(), 1u);
+	TEST_ASSERT_EQUALS(readable.first[0], 10);
+	TEST_ASSERT_EQUALS(readable.first[1], 11);
+	TEST_ASSERT_EQUALS(readable.second[0], 12);
+
+	queue.pop(2);
+	TEST_ASSERT_EQUALS(queue.get(), 12);
+	readable = queue.getReadableRegions();
+	TEST_ASSERT_EQUALS(readable.first.size(), 1u);
+	TEST_ASSERT_EQUALS(readable.second.size(), 0u);
+
+	queue.pop(1);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/driver/atomic/ring.hpp>
+
+#include "atomic_ring_test.hpp"
+
+void
+AtomicRingTest::testSpsc()
+{
+	modm::atomic::SpscRing<int16_t, 4> ring;
+	int16_t value{0};
+
+	TEST_ASSERT_TRUE(ring.isEmpty());
+	TEST_ASSERT_EQUALS(ring.getMaxSize(), 4u);
+	TEST_ASSERT_FALSE(ring.pop(value));
+
+	TEST_ASSERT_TRUE(ring.push(1));
+	TEST_ASSERT_TRUE(ring.push(2));
+	TEST_ASSERT_TRUE(ring.push(3));
+	TEST_ASSERT_TRUE(ring.push(4));
+	TEST_ASSERT_TRUE(ring.isFull());
+	TEST_ASSERT_FALSE(ring.push(5));
+
+	TEST_ASSERT_TRUE(ring.pop(value));
+	TEST_ASSERT_EQUALS(value, 1);
+	TEST_ASSERT_TRUE(ring.push(5));
+	TEST_ASSERT_EQUALS(ring.getSize(), 4u);
+
+	for (int16_t expected = 2; expected <= 5; expected++)
+	{
+		TEST_ASSERT_TRUE(ring.pop(value));
+		TEST_ASSERT_EQUALS(value, expected);
+	}
+	TEST_ASSERT_TRUE(ring.isEmpty());
+	TEST_ASSERT_FALSE(ring.pop(value));
+}
+
+void
+AtomicRingTest::testSpscBulk()
+{
+	modm::atomic::SpscRing<uint8_t, 8> ring;
+	const uint8_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	uint8_t output[10]{};
+
+	TEST_ASSERT_EQUALS(ring.push(std::span{input, 5}), 5u);
+	TEST_ASSERT_EQUALS(ring.pop(std::span{output, 3}), 3u);
+	TEST_ASSERT_EQUALS(output[2], 3);
+
+	// wraps around the end of the buffer and stops when full
+	TEST_ASSERT_EQUALS(ring.push(std::span{input + 5, 5}), 5u);
+	TEST_ASSERT_EQUALS(ring.push(std::span{input, 2}), 1u);
+	TEST_ASSERT_TRUE(ring.isFull());
+
+	TEST_ASSERT_EQUALS(ring.pop(std::span{output}), 8u);
+	const uint8_t expected[] = {4, 5, 6, 7, 8, 9, 10, 1};
+	TEST_ASSERT_EQUALS_ARRAY(output, expected, 8);
+	TEST_ASSERT_EQUALS(ring.pop(std::span{output}), 0u);
+}
+
+void
+AtomicRingTest::testMpmc()
+{
+	modm::atomic::MpmcRing<uint32_t, 4> ring;
+	uint32_t value{0};
+
+	TEST_ASSERT_TRUE(ring.isEmpty());
+	TEST_ASSERT_FALSE(ring.pop(value));
+
+	// several rounds through the buffer
+	for (uint32_t round = 0; round < 3; round++)
+	{
+		for (uint32_t ii = 0; ii < 4; ii++) {
+			TEST_ASSERT_TRUE(ring.push(round * 10 + ii));
+		}
+		TEST_ASSERT_TRUE(ring.isFull());
+		TEST_ASSERT_EQUALS(ring.getSize(), 4u);
+		TEST_ASSERT_FALSE(ring.push(100));
+
+		for (uint32_t ii = 0; ii < 4; ii++)
+		{
+			TEST_ASSERT_TRUE(ring.pop(value));
+			TEST_ASSERT_EQUALS(value, round * 10 + ii);
+		}
+		TEST_ASSERT_TRUE(ring.isEmpty());
+		TEST_ASSERT_FALSE(ring.pop(value));
+	}
+
+	TEST_ASSERT_TRUE(ring.push(1));
+	TEST_ASSERT_TRUE(ring.push(2));
+	TEST_ASSERT_TRUE(ring.pop(value));
+	TEST_ASSERT_EQUALS(value, 1u);
+	TEST_ASSERT_TRUE(ring.push(3));
+	TEST_ASSERT_EQUALS(ring.getSize(), 2u);
+}
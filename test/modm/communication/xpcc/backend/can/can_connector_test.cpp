@@ -101,7 +101,7 @@ CanConnectorTest::testSendShortMessageDirect()
 {
 	driver->sendSlots = 1;
 
-	modm::SmartPointer payload(&shortPayload);
+	modm::SharedBuffer payload(&shortPayload);
 	connector->sendPacket(xpccHeader, payload);
 
 	// short messages might be send directly without any call to update
@@ -112,7 +112,7 @@ CanConnectorTest::testSendShortMessageDirect()
 void
 CanConnectorTest::testSendShortMessage()
 {
-	modm::SmartPointer payload(&shortPayload);
+	modm::SharedBuffer payload(&shortPayload);
 	connector->sendPacket(xpccHeader, payload);
 
 	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
@@ -130,15 +130,15 @@ CanConnectorTest::testSendFragmentedMessage()
 	driver->sendSlots = 2;
 	this->messageCounter = connector->messageCounter = 0x30;
 
-	modm::SmartPointer payload(&fragmentedPayload);
+	modm::SharedBuffer payload(&fragmentedPayload);
 	connector->sendPacket(xpccHeader, payload);
 
 	// fragmented messages aren't send directly but queued immediately
 	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
 
-	// with two send slots two message should be send
+	// with two send slots two frames are send by one update
 	connector->update();
-	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 1U);
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 2U);
 	connector->update();
 	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 2U);
 
@@ -159,6 +159,30 @@ CanConnectorTest::testSendFragmentedMessage()
 	TEST_ASSERT_EQUALS(connector->messageCounter, 0x40);
 }
 
+void
+CanConnectorTest::testSendMultipleMessages()
+{
+	modm::SharedBuffer payload(&shortPayload);
+	connector->sendPacket(xpccHeader, payload);
+	connector->sendPacket(xpccHeader, modm::SharedBuffer());
+
+	// the third message must not overtake the waiting ones
+	driver->sendSlots = 1;
+	connector->sendPacket(xpccHeader, payload);
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 0U);
+
+	driver->sendSlots = 5;
+	connector->update();
+
+	TEST_ASSERT_EQUALS(driver->sendList.getSize(), 3U);
+	TEST_ASSERT_EQUALS(driver->sendSlots, 2U);
+	checkShortMessage(driver->sendList.getFront());
+	driver->sendList.removeFront();
+	TEST_ASSERT_EQUALS(driver->sendList.getFront().length, 0U);
+	driver->sendList.removeFront();
+	checkShortMessage(driver->sendList.getFront());
+}
+
 void
 CanConnectorTest::testReceiveShortMessage()
 {
@@ -257,3 +281,91 @@ CanConnectorTest::testReceiveFragmentedMessage()
 
 	TEST_ASSERT_FALSE(connector->isPacketAvailable());
 }
+
+void
+CanConnectorTest::testReceiveTooManyFragmentedMessages()
+{
+	constexpr uint8_t messages = TestingCanConnector::maxPendingMessages + 1;
+
+	this->messageCounter = 0x20;
+	modm::can::Message message;
+
+	// start more messages than can be reassembled at the same time
+	for (uint8_t i = 0; i < messages; ++i)
+	{
+		createMessage(message, 0);
+		message.identifier = fragmentedIdentifier + i;
+		driver->receiveList.append(message);
+	}
+	connector->update();
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+
+	// the first message was dropped to make room for the last one
+	for (uint8_t i = messages; i-- > 0; )
+	{
+		for (uint8_t fragment = 1; fragment < 3; ++fragment)
+		{
+			createMessage(message, fragment);
+			message.identifier = fragmentedIdentifier + i;
+			driver->receiveList.append(message);
+		}
+	}
+	connector->update();
+
+	for (uint8_t i = messages - 1; i > 0; --i)
+	{
+		TEST_ASSERT_TRUE(connector->isPacketAvailable());
+		TEST_ASSERT_EQUALS(connector->getPacketHeader().packetIdentifier, 0x56 + i);
+		TEST_ASSERT_EQUALS_ARRAY(
+				connector->getPacketPayload().getPointer(),
+				fragmentedPayload,
+				sizeof(fragmentedPayload));
+		connector->dropPacket();
+	}
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+}
+
+void
+CanConnectorTest::testReceiveInterleavedFragmentedMessages()
+{
+	// messages which only differ in the flags or the message counter
+	const xpcc::Header headers[] = {
+		xpccHeader,
+		xpcc::Header(xpcc::Header::Type::REQUEST, true, 0x12, 0x34, 0x56),
+		xpcc::Header(xpcc::Header::Type::TIMEOUT, false, 0x12, 0x34, 0x56),
+		xpccHeader,
+	};
+	const uint32_t identifiers[] = {
+		fragmentedIdentifier,
+		fragmentedIdentifier | 0x04000000,
+		fragmentedIdentifier | 0x18000000,
+		fragmentedIdentifier,
+	};
+	const uint8_t counters[] = {0x10, 0x10, 0x10, 0xf0};
+	modm::can::Message message;
+
+	for (uint8_t fragment = 0; fragment < 3; ++fragment)
+	{
+		for (uint8_t i = 0; i < 4; ++i)
+		{
+			this->messageCounter = counters[i];
+			createMessage(message, fragment);
+			message.identifier = identifiers[i];
+			driver->receiveList.append(message);
+		}
+	}
+	connector->update();
+
+	for (uint8_t i = 0; i < 4; ++i)
+	{
+		TEST_ASSERT_TRUE(connector->isPacketAvailable());
+		TEST_ASSERT_EQUALS(connector->getPacketHeader(), headers[i]);
+		TEST_ASSERT_EQUALS(connector->getPacketPayload().getSize(), sizeof(fragmentedPayload));
+		TEST_ASSERT_EQUALS_ARRAY(
+				connector->getPacketPayload().getPointer(),
+				fragmentedPayload,
+				sizeof(fragmentedPayload));
+		connector->dropPacket();
+	}
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+}
@@ -53,12 +53,21 @@ public:
     void
     testSendFragmentedMessage();
 
+    void
+    testSendMultipleMessages();
+
     void
     testReceiveShortMessage();
 
     void
     testReceiveFragmentedMessage();
 
+    void
+    testReceiveTooManyFragmentedMessages();
+
+    void
+    testReceiveInterleavedFragmentedMessages();
+
 private:
 	TestingCanConnector *connector;
 	modm_test::platform::CanDriver *driver;
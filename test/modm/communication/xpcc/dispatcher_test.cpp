@@ -49,7 +49,7 @@ void
 DispatcherTest::testReceiveRequest()
 {
 	Message message(xpcc::Header(xpcc::Header::Type::REQUEST, false, 1, 10, 0x10),
-			modm::SmartPointer());
+			modm::SharedBuffer());
 
 	backend->messagesToReceive.append(message);
 
@@ -71,7 +71,7 @@ void
 DispatcherTest::testReceiveRequestNoComponent()
 {
 	Message message(xpcc::Header(xpcc::Header::Type::REQUEST, false, 11, 10, 0x10),
-			modm::SmartPointer());
+			modm::SharedBuffer());
 
 	backend->messagesToReceive.append(message);
 
@@ -89,7 +89,7 @@ void
 DispatcherTest::testReceiveResponse()
 {
 	Message message(xpcc::Header(xpcc::Header::Type::RESPONSE, false, 1, 10, 0x10),
-			modm::SmartPointer());
+			modm::SharedBuffer());
 
 	backend->messagesToReceive.append(message);
 
@@ -109,7 +109,7 @@ void
 DispatcherTest::testReceiveResponseNoComponent()
 {
 	Message message(xpcc::Header(xpcc::Header::Type::RESPONSE, false, 11, 10, 0x10),
-			modm::SmartPointer());
+			modm::SharedBuffer());
 
 	backend->messagesToReceive.append(message);
 
@@ -124,7 +124,7 @@ void
 DispatcherTest::testEventReception()
 {
 	Message message(xpcc::Header(xpcc::Header::Type::REQUEST, false, 0, 10, 0x20),
-			modm::SmartPointer());
+			modm::SharedBuffer());
 
 	backend->messagesToReceive.append(message);
 
@@ -437,7 +437,7 @@ DispatcherTest::testActionRetransmission()
 	// send requested ACK
 	backend->messagesToReceive.append(
 			Message(xpcc::Header(xpcc::Header::Type::REQUEST, true, 1, 10, 0xf3),
-					modm::SmartPointer()));
+					modm::SharedBuffer()));
 
 	// reset time so that the timeout is expired
 	test_clock::increment(500);
@@ -452,7 +452,7 @@ DispatcherTest::testResponseRetransmissionWithAbort()
 {
 	backend->messagesToReceive.append(
 			Message(xpcc::Header(xpcc::Header::Type::REQUEST, false, 1, 10, 0x12),
-					modm::SmartPointer()));
+					modm::SharedBuffer()));
 
 	dispatcher->update();
 
@@ -492,7 +492,7 @@ DispatcherTest::testResponseRetransmission()
 {
 	backend->messagesToReceive.append(
 			Message(xpcc::Header(xpcc::Header::Type::REQUEST, false, 1, 10, 0x12),
-					modm::SmartPointer()));
+					modm::SharedBuffer()));
 
 	dispatcher->update();
 
@@ -519,7 +519,7 @@ DispatcherTest::testResponseRetransmission()
 	// send requested ACK
 	backend->messagesToReceive.append(
 			Message(xpcc::Header(xpcc::Header::Type::RESPONSE, true, 1, 10, 0x12),
-					modm::SmartPointer()));
+					modm::SharedBuffer()));
 
 	// reset time so that the timeout is expired if still active
 	test_clock::increment(100);
@@ -528,3 +528,36 @@ DispatcherTest::testResponseRetransmission()
 
 	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 0U);
 }
+
+void
+DispatcherTest::testAcknowledgeOutOfOrder()
+{
+	component1->callAction(10, 0xf1);
+	component1->callAction(10, 0xf2);
+	component1->callAction(10, 0xf3);
+
+	dispatcher->update();
+
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 3U);
+	backend->messagesSend.removeAll();
+
+	// acknowledge the last and the first request
+	backend->messagesToReceive.append(
+			Message(xpcc::Header(xpcc::Header::Type::REQUEST, true, 1, 10, 0xf3),
+					modm::SharedBuffer()));
+	backend->messagesToReceive.append(
+			Message(xpcc::Header(xpcc::Header::Type::REQUEST, true, 1, 10, 0xf1),
+					modm::SharedBuffer()));
+
+	dispatcher->update();
+
+	// reset time so that the timeout is expired
+	test_clock::increment(500);
+
+	dispatcher->update();
+
+	// only the request without ACK is retransmitted
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 1U);
+	TEST_ASSERT_EQUALS(backend->messagesSend.getFront().header,
+			xpcc::Header(xpcc::Header::Type::REQUEST, false, 10, 1, 0xf2));
+}
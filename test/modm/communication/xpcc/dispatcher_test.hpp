@@ -112,6 +112,9 @@ public:
 	void
 	testResponseRetransmission();
 
+	void
+	testAcknowledgeOutOfOrder();
+
 private:
 	xpcc::Dispatcher *dispatcher;
 	FakeBackend *backend;
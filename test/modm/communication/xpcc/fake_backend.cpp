@@ -21,7 +21,7 @@ FakeBackend::update()
 // ----------------------------------------------------------------------------
 void
 FakeBackend::sendPacket(const xpcc::Header &header,
-		modm::SmartPointer payload)
+		modm::SharedBuffer payload)
 {
 	this->messagesSend.append(Message(header, payload));
 }
@@ -39,7 +39,7 @@ FakeBackend::getPacketHeader() const
 	return this->messagesToReceive.getFront().header;
 }
 
-const modm::SmartPointer
+const modm::SharedBuffer&
 FakeBackend::getPacketPayload() const
 {
 	return this->messagesToReceive.getFront().payload;
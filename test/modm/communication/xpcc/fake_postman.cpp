@@ -17,7 +17,7 @@
 
 xpcc::Postman::DeliverInfo
 FakePostman::deliverPacket(const xpcc::Header& header,
-			const modm::SmartPointer& payload)
+			const modm::SharedBuffer& payload)
 {
 	this->messagesToDeliver.append(Message(header, payload));
 
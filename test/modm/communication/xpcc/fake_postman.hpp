@@ -35,7 +35,7 @@ public:
 
 	virtual DeliverInfo
 	deliverPacket(const xpcc::Header& header,
-			const modm::SmartPointer& payload);
+			const modm::SharedBuffer& payload);
 
 	virtual bool
 	isComponentAvailable(uint8_t component) const;
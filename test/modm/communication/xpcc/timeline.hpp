@@ -16,7 +16,7 @@
 
 #include <modm/communication/xpcc.hpp>
 #include <modm/container/linked_list.hpp>
-#include <modm/container/smart_pointer.hpp>
+#include <modm/container/shared_buffer.hpp>
 
 /// @ingroup modm_test_test_communication_xpcc
 class Timeline
@@ -44,7 +44,7 @@ public:
 		uint8_t id;
 		uint8_t source;
 
-		modm::SmartPointer payload;
+		modm::SharedBuffer payload;
 
 	private:
 		Event&
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/flat_map.hpp>
+
+#include "flat_map_test.hpp"
+
+namespace
+{
+	using Map = modm::flat_map<uint8_t, int16_t, 5>;
+
+	constexpr Map table{{30, 3}, {10, 1}, {20, 2}, {10, 4}};
+
+	static_assert(table.getSize() == 3);
+	static_assert(table.find(20)->second == 2);
+	static_assert(table.begin()->first == 10);
+	static_assert(table.begin()->second == 1);
+	static_assert(not table.contains(40));
+
+	constexpr Map
+	modified()
+	{
+		Map map{{1, 1}, {2, 2}};
+		map[3] = 3;
+		map.erase(1);
+		return map;
+	}
+	static_assert(modified() == Map{{2, 2}, {3, 3}});
+}
+
+void
+FlatMapTest::testConstexpr()
+{
+	TEST_ASSERT_EQUALS(table.getSize(), 3U);
+	TEST_ASSERT_EQUALS(table.getMaxSize(), 5U);
+
+	// sorted by key
+	Map::const_iterator it = table.begin();
+	TEST_ASSERT_EQUALS(it->first, 10);
+	TEST_ASSERT_EQUALS((it + 1)->first, 20);
+	TEST_ASSERT_EQUALS((it + 2)->first, 30);
+
+	TEST_ASSERT_EQUALS(table.find(30)->second, 3);
+	TEST_ASSERT_TRUE(table.find(31) == table.end());
+}
+
+void
+FlatMapTest::testInsert()
+{
+	Map map;
+
+	TEST_ASSERT_TRUE(map.isEmpty());
+
+	auto [it, inserted] = map.insert({5, 50});
+	TEST_ASSERT_TRUE(inserted);
+	TEST_ASSERT_EQUALS(it->first, 5);
+	TEST_ASSERT_EQUALS(it->second, 50);
+
+	TEST_ASSERT_TRUE(map.insert({1, 10}).second);
+	TEST_ASSERT_TRUE(map.try_emplace(3, 30).second);
+
+	// the key exists already
+	auto result = map.insert({3, 31});
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_EQUALS(result.first->second, 30);
+
+	result = map.insert_or_assign(3, 32);
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_EQUALS(map.find(3)->second, 32);
+
+	TEST_ASSERT_EQUALS(map.getSize(), 3U);
+	TEST_ASSERT_TRUE((map == Map{{1, 10}, {3, 32}, {5, 50}}));
+}
+
+void
+FlatMapTest::testFull()
+{
+	Map map{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+
+	TEST_ASSERT_TRUE(map.isFull());
+
+	auto result = map.insert({6, 6});
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_TRUE(result.first == map.end());
+
+	// existing keys can still be found and assigned
+	result = map.insert_or_assign(2, 20);
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_EQUALS(map[2], 20);
+	TEST_ASSERT_EQUALS(map.getSize(), 5U);
+}
+
+void
+FlatMapTest::testErase()
+{
+	Map map{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+
+	TEST_ASSERT_EQUALS(map.erase(2), 1U);
+	TEST_ASSERT_EQUALS(map.erase(2), 0U);
+	TEST_ASSERT_TRUE((map == Map{{1, 1}, {3, 3}, {4, 4}}));
+
+	Map::iterator it = map.erase(map.find(1));
+	TEST_ASSERT_EQUALS(it->first, 3);
+	TEST_ASSERT_TRUE((map == Map{{3, 3}, {4, 4}}));
+
+	map.clear();
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_TRUE(map.find(3) == map.end());
+}
+
+void
+FlatMapTest::testAccess()
+{
+	Map map;
+
+	map[7] = 70;
+	map[2] += 5;
+
+	TEST_ASSERT_EQUALS(map.getSize(), 2U);
+	TEST_ASSERT_EQUALS(map[7], 70);
+	TEST_ASSERT_EQUALS(map[2], 5);
+	TEST_ASSERT_EQUALS(map.count(7), 1U);
+	TEST_ASSERT_EQUALS(map.count(8), 0U);
+
+	TEST_ASSERT_EQUALS(map.lower_bound(3)->first, 7);
+	TEST_ASSERT_EQUALS(map.lower_bound(7)->first, 7);
+	TEST_ASSERT_TRUE(map.upper_bound(7) == map.end());
+}
+
+void
+FlatMapTest::testIterator()
+{
+	Map map{{4, 40}, {2, 20}, {3, 30}};
+
+	uint8_t key = 2;
+	for (auto& [k, value] : map)
+	{
+		TEST_ASSERT_EQUALS(k, key);
+		TEST_ASSERT_EQUALS(value, key * 10);
+		value++;
+		key++;
+	}
+	TEST_ASSERT_EQUALS(key, 5);
+	TEST_ASSERT_EQUALS(map[3], 31);
+}
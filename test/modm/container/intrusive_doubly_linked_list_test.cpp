@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/intrusive_doubly_linked_list.hpp>
+
+#include "intrusive_doubly_linked_list_test.hpp"
+
+namespace
+{
+	struct Element
+	{
+		Element(int16_t value = 0) :
+			value(value)
+		{}
+
+		int16_t value;
+		modm::IntrusiveDoublyLinkedListHook<Element> hook;
+		modm::IntrusiveDoublyLinkedListHook<Element> other;
+	};
+
+	using List = modm::IntrusiveDoublyLinkedList<Element>;
+	using OtherList = modm::IntrusiveDoublyLinkedList<Element, &Element::other>;
+}
+
+void
+IntrusiveDoublyLinkedListTest::testAppendPrepend()
+{
+	List list;
+	Element a(1), b(2), c(3);
+
+	TEST_ASSERT_TRUE(list.isEmpty());
+
+	list.append(b);
+	TEST_ASSERT_TRUE(&list.getFront() == &b);
+	TEST_ASSERT_TRUE(&list.getBack() == &b);
+
+	list.append(c);
+	list.prepend(a);
+
+	TEST_ASSERT_FALSE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_TRUE(&list.getFront() == &a);
+	TEST_ASSERT_TRUE(&list.getBack() == &c);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testRemoveFrontBack()
+{
+	List list;
+	Element a(1), b(2), c(3);
+
+	list.append(a);
+	list.append(b);
+	list.append(c);
+
+	list.removeBack();
+	TEST_ASSERT_TRUE(&list.getBack() == &b);
+	list.removeFront();
+	TEST_ASSERT_TRUE(&list.getFront() == &b);
+	TEST_ASSERT_TRUE(&list.getBack() == &b);
+	list.removeBack();
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+
+	list.prepend(c);
+	TEST_ASSERT_TRUE(&list.getFront() == &c);
+	TEST_ASSERT_TRUE(&list.getBack() == &c);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testIterator()
+{
+	List list;
+	Element elements[4] = {1, 2, 3, 4};
+	for (Element& element : elements) {
+		list.append(element);
+	}
+
+	int16_t expected = 1;
+	for (Element& element : list) {
+		TEST_ASSERT_EQUALS(element.value, expected);
+		expected++;
+	}
+
+	// iterate backwards from the end
+	List::const_iterator it = static_cast<const List&>(list).end();
+	do {
+		--it;
+		expected--;
+		TEST_ASSERT_EQUALS(it->value, expected);
+	}
+	while (it != list.begin());
+	TEST_ASSERT_EQUALS(expected, 1);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testRemove()
+{
+	List list;
+	Element elements[5] = {1, 2, 3, 4, 5};
+	for (Element& element : elements) {
+		list.append(element);
+	}
+
+	// remove by reference in constant time
+	list.remove(elements[2]);
+	list.remove(elements[4]);
+	list.remove(elements[0]);
+
+	TEST_ASSERT_EQUALS(list.getSize(), 2U);
+	TEST_ASSERT_EQUALS(list.getFront().value, 2);
+	TEST_ASSERT_EQUALS(list.getBack().value, 4);
+
+	// remove by iterator
+	List::iterator it = list.remove(list.begin());
+	TEST_ASSERT_EQUALS(it->value, 4);
+	it = list.remove(it);
+	TEST_ASSERT_TRUE(it == list.end());
+	TEST_ASSERT_TRUE(list.isEmpty());
+
+	// removed elements can be linked again
+	list.append(elements[2]);
+	list.prepend(elements[0]);
+	TEST_ASSERT_EQUALS(list.getFront().value, 1);
+	TEST_ASSERT_EQUALS(list.getBack().value, 3);
+
+	list.removeAll();
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveDoublyLinkedListTest::testInsert()
+{
+	List list;
+	Element a(1), b(2), c(3), d(4);
+
+	list.insert(list.end(), a);
+	list.insert(list.begin(), c);
+	list.insert(list.begin(), b);
+	List::iterator it = list.insert(list.end(), d);
+
+	TEST_ASSERT_EQUALS(it->value, 4);
+	--it;
+	TEST_ASSERT_EQUALS(it->value, 3);
+
+	int16_t expected = 1;
+	for (const Element& element : list) {
+		TEST_ASSERT_EQUALS(element.value, expected);
+		expected++;
+	}
+	TEST_ASSERT_EQUALS(list.getSize(), 4U);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testMultipleHooks()
+{
+	List list;
+	OtherList other;
+	Element a(1), b(2);
+
+	list.append(a);
+	list.append(b);
+	other.append(b);
+	other.append(a);
+
+	TEST_ASSERT_EQUALS(list.getFront().value, 1);
+	TEST_ASSERT_EQUALS(other.getFront().value, 2);
+
+	list.remove(a);
+	TEST_ASSERT_EQUALS(list.getSize(), 1U);
+	TEST_ASSERT_EQUALS(other.getSize(), 2U);
+	TEST_ASSERT_EQUALS(other.getBack().value, 1);
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/intrusive_linked_list.hpp>
+
+#include "intrusive_linked_list_test.hpp"
+
+namespace
+{
+	struct Element
+	{
+		Element(int16_t value = 0) :
+			value(value)
+		{}
+
+		int16_t value;
+		modm::IntrusiveLinkedListHook<Element> hook;
+	};
+
+	using List = modm::IntrusiveLinkedList<Element>;
+}
+
+void
+IntrusiveLinkedListTest::testAppendPrepend()
+{
+	List list;
+	Element a(1), b(2), c(3);
+
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+
+	list.append(b);
+
+	TEST_ASSERT_FALSE(list.isEmpty());
+	TEST_ASSERT_TRUE(&list.getFront() == &b);
+	TEST_ASSERT_TRUE(&list.getBack() == &b);
+
+	list.append(c);
+	list.prepend(a);
+
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_TRUE(&list.getFront() == &a);
+	TEST_ASSERT_TRUE(&list.getBack() == &c);
+}
+
+void
+IntrusiveLinkedListTest::testRemoveFront()
+{
+	List list;
+	Element a(1), b(2);
+
+	list.append(a);
+	list.append(b);
+
+	list.removeFront();
+	TEST_ASSERT_EQUALS(list.getSize(), 1U);
+	TEST_ASSERT_TRUE(&list.getFront() == &b);
+	TEST_ASSERT_TRUE(&list.getBack() == &b);
+
+	list.removeFront();
+	TEST_ASSERT_TRUE(list.isEmpty());
+
+	// the list must be usable after being emptied
+	list.append(a);
+	TEST_ASSERT_TRUE(&list.getFront() == &a);
+	TEST_ASSERT_TRUE(&list.getBack() == &a);
+}
+
+void
+IntrusiveLinkedListTest::testIterator()
+{
+	List list;
+	Element elements[4] = {1, 2, 3, 4};
+	for (Element& element : elements) {
+		list.append(element);
+	}
+
+	int16_t expected = 1;
+	for (List::iterator it = list.begin(); it != list.end(); ++it) {
+		TEST_ASSERT_EQUALS(it->value, expected);
+		it->value *= 10;
+		expected++;
+	}
+
+	const List& constList = list;
+	expected = 10;
+	for (const Element& element : constList) {
+		TEST_ASSERT_EQUALS(element.value, expected);
+		expected += 10;
+	}
+	TEST_ASSERT_EQUALS(expected, 50);
+}
+
+void
+IntrusiveLinkedListTest::testRemove()
+{
+	List list;
+	Element elements[4] = {1, 2, 3, 4};
+	for (Element& element : elements) {
+		list.append(element);
+	}
+
+	// remove from the middle and the end while iterating
+	List::iterator it = list.begin();
+	while (it != list.end())
+	{
+		if (it->value % 2 == 0) {
+			it = list.remove(it);
+		} else {
+			++it;
+		}
+	}
+
+	TEST_ASSERT_EQUALS(list.getSize(), 2U);
+	TEST_ASSERT_EQUALS(list.getFront().value, 1);
+	TEST_ASSERT_EQUALS(list.getBack().value, 3);
+
+	list.append(elements[3]);
+	TEST_ASSERT_EQUALS(list.getBack().value, 4);
+
+	// remove the front
+	it = list.remove(list.begin());
+	TEST_ASSERT_EQUALS(it->value, 3);
+	TEST_ASSERT_EQUALS(list.getFront().value, 3);
+	TEST_ASSERT_EQUALS(list.getSize(), 2U);
+}
+
+void
+IntrusiveLinkedListTest::testInsert()
+{
+	List list;
+	Element a(1), b(2), c(3), d(4);
+
+	list.insert(list.end(), b);
+	TEST_ASSERT_TRUE(&list.getFront() == &b);
+
+	// inserts after the position
+	list.insert(list.begin(), d);
+	TEST_ASSERT_TRUE(&list.getBack() == &d);
+	list.insert(list.begin(), c);
+	list.prepend(a);
+
+	int16_t expected = 1;
+	for (const Element& element : list) {
+		TEST_ASSERT_EQUALS(element.value, expected);
+		expected++;
+	}
+	TEST_ASSERT_EQUALS(list.getSize(), 4U);
+}
+
+void
+IntrusiveLinkedListTest::testMove()
+{
+	List first, second;
+	Element a(1), b(2);
+
+	first.append(a);
+	first.append(b);
+
+	// moving an element between lists does not copy it
+	Element& element = first.getFront();
+	first.removeFront();
+	second.append(element);
+
+	TEST_ASSERT_TRUE(&second.getFront() == &a);
+	TEST_ASSERT_TRUE(&first.getFront() == &b);
+
+	// copies are not linked
+	Element copy(b);
+	first.append(copy);
+	TEST_ASSERT_EQUALS(first.getSize(), 2U);
+	first.removeFront();
+	TEST_ASSERT_TRUE(&first.getFront() == &copy);
+	TEST_ASSERT_EQUALS(first.getSize(), 1U);
+
+	first.removeAll();
+	TEST_ASSERT_TRUE(first.isEmpty());
+}
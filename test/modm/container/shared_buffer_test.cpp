@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/shared_buffer.hpp>
+
+#include "shared_buffer_test.hpp"
+
+namespace
+{
+	struct Data
+	{
+		uint16_t a;
+		uint32_t b;
+	};
+}
+
+void
+SharedBufferTest::testEmpty()
+{
+	modm::SharedBuffer buffer;
+
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+	TEST_ASSERT_EQUALS(buffer.getSize(), 0U);
+	TEST_ASSERT_EQUALS(buffer.getReferenceCount(), 0U);
+	TEST_ASSERT_TRUE(buffer.getPointer() != nullptr);
+
+	modm::SharedBuffer zero(uint16_t(0));
+	TEST_ASSERT_TRUE(zero.isEmpty());
+	TEST_ASSERT_TRUE(zero == buffer);
+}
+
+void
+SharedBufferTest::testCopyData()
+{
+	const Data data{0x1234, 0xdeadbeef};
+	modm::SharedBuffer buffer(&data);
+
+	TEST_ASSERT_EQUALS(buffer.getSize(), sizeof(Data));
+	TEST_ASSERT_EQUALS(buffer.getReferenceCount(), 1U);
+	TEST_ASSERT_EQUALS(buffer.get<Data>().a, 0x1234U);
+	TEST_ASSERT_EQUALS(buffer.get<Data>().b, 0xdeadbeefU);
+
+	Data copy{};
+	TEST_ASSERT_TRUE(buffer.get(copy));
+	TEST_ASSERT_EQUALS(copy.b, 0xdeadbeefU);
+
+	uint8_t wrongSize;
+	TEST_ASSERT_FALSE(buffer.get(wrongSize));
+
+	const uint8_t bytes[3] = {1, 2, 3};
+	modm::SharedBuffer raw(bytes, sizeof(bytes));
+	TEST_ASSERT_EQUALS(raw.getSize(), 3U);
+	TEST_ASSERT_EQUALS_ARRAY(raw.getPointer(), bytes, 3U);
+}
+
+void
+SharedBufferTest::testSharing()
+{
+	modm::SharedBuffer buffer(uint16_t(4));
+	buffer.getPointer()[0] = 42;
+	{
+		modm::SharedBuffer copy(buffer);
+		TEST_ASSERT_TRUE(copy == buffer);
+		TEST_ASSERT_EQUALS(buffer.getReferenceCount(), 2U);
+
+		// the storage is shared and not copied
+		TEST_ASSERT_TRUE(copy.getPointer() == buffer.getPointer());
+		copy.getPointer()[1] = 43;
+
+		modm::SharedBuffer other;
+		other = copy;
+		TEST_ASSERT_EQUALS(buffer.getReferenceCount(), 3U);
+
+		const modm::SharedBuffer& self = other;
+		other = self;
+		TEST_ASSERT_EQUALS(buffer.getReferenceCount(), 3U);
+	}
+	TEST_ASSERT_EQUALS(buffer.getReferenceCount(), 1U);
+	TEST_ASSERT_EQUALS(buffer.getPointer()[0], 42);
+	TEST_ASSERT_EQUALS(buffer.getPointer()[1], 43);
+
+	buffer = modm::SharedBuffer();
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+}
+
+void
+SharedBufferTest::testMove()
+{
+	modm::SharedBuffer buffer(uint16_t(8));
+	const uint8_t *pointer = buffer.getPointer();
+
+	modm::SharedBuffer moved(std::move(buffer));
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+	TEST_ASSERT_EQUALS(moved.getReferenceCount(), 1U);
+	TEST_ASSERT_TRUE(moved.getPointer() == pointer);
+
+	modm::SharedBuffer target(uint16_t(2));
+	target = std::move(moved);
+	TEST_ASSERT_TRUE(moved.isEmpty());
+	TEST_ASSERT_EQUALS(target.getSize(), 8U);
+	TEST_ASSERT_TRUE(target.getPointer() == pointer);
+}
+
+void
+SharedBufferTest::testSlabReuse()
+{
+	modm::SharedBuffer::reserve(2);
+
+	const uint8_t *pointer;
+	{
+		modm::SharedBuffer buffer(uint16_t(10));
+		pointer = buffer.getPointer();
+	}
+
+	// the released slab is reused for the next buffer of any pooled size
+	modm::SharedBuffer buffer(modm::SharedBuffer::SlabCapacity);
+	TEST_ASSERT_TRUE(buffer.getPointer() == pointer);
+}
+
+void
+SharedBufferTest::testLargeBuffer()
+{
+	modm::SharedBuffer buffer(uint16_t(modm::SharedBuffer::SlabCapacity + 100));
+	TEST_ASSERT_EQUALS(buffer.getSize(), modm::SharedBuffer::SlabCapacity + 100U);
+
+	for (uint16_t i = 0; i < buffer.getSize(); i++) {
+		buffer.getPointer()[i] = i;
+	}
+	modm::SharedBuffer copy(buffer);
+	TEST_ASSERT_EQUALS(copy.getPointer()[155], 155);
+}
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/small_vector.hpp>
+
+#include "small_vector_test.hpp"
+
+namespace
+{
+	// Counts the number of alive objects
+	struct Element
+	{
+		static inline int16_t instances = 0;
+
+		Element(int16_t value = 0) :
+			value(value)
+		{
+			instances++;
+		}
+
+		Element(const Element& other) :
+			value(other.value)
+		{
+			instances++;
+		}
+
+		Element(Element&& other) :
+			value(other.value)
+		{
+			other.value = -1;
+			instances++;
+		}
+
+		Element&
+		operator = (const Element& other) = default;
+
+		Element&
+		operator = (Element&& other)
+		{
+			value = other.value;
+			other.value = -1;
+			return *this;
+		}
+
+		~Element()
+		{
+			instances--;
+		}
+
+		int16_t value;
+	};
+
+	using Vector = modm::small_vector<int16_t, 3>;
+
+	bool
+	isInline(const Vector& vector)
+	{
+		const void* begin = &vector;
+		const void* end = &vector + 1;
+		const void* data = vector.data();
+		return data >= begin and data < end;
+	}
+}
+
+void
+SmallVectorTest::testInline()
+{
+	Vector vector{1, 2};
+
+	TEST_ASSERT_TRUE(isInline(vector));
+	TEST_ASSERT_EQUALS(vector.getCapacity(), 3U);
+
+	vector.append(3);
+
+	TEST_ASSERT_TRUE(isInline(vector));
+	TEST_ASSERT_TRUE(vector.isFull());
+	TEST_ASSERT_TRUE((vector == Vector{1, 2, 3}));
+}
+
+void
+SmallVectorTest::testGrow()
+{
+	Vector vector{1, 2, 3};
+
+	TEST_ASSERT_TRUE(vector.append(4));
+
+	TEST_ASSERT_FALSE(isInline(vector));
+	TEST_ASSERT_EQUALS(vector.getCapacity(), 6U);
+	TEST_ASSERT_FALSE(vector.isFull());
+	TEST_ASSERT_TRUE((vector == Vector{1, 2, 3, 4}));
+
+	for (int16_t ii = 5; ii <= 20; ++ii) {
+		vector.push_back(ii);
+	}
+
+	TEST_ASSERT_EQUALS(vector.getSize(), 20U);
+	TEST_ASSERT_EQUALS(vector.getCapacity(), 24U);
+	for (int16_t ii = 0; ii < 20; ++ii) {
+		TEST_ASSERT_EQUALS(vector[ii], ii + 1);
+	}
+
+	// the appended value refers to an element which is moved when growing
+	Vector full{7, 8, 9};
+	full.push_back(full[0]);
+	TEST_ASSERT_TRUE((full == Vector{7, 8, 9, 7}));
+
+	// also when resizing past the capacity
+	full.resize(30, full[1]);
+	TEST_ASSERT_EQUALS(full.getSize(), 30U);
+	for (std::size_t ii = 4; ii < 30; ++ii) {
+		TEST_ASSERT_EQUALS(full[ii], 8);
+	}
+
+	modm::small_vector<Element, 2> elements;
+	elements.emplace_back(1);
+	elements.emplace_back(2);
+	elements.resize(5, elements[1]);
+	TEST_ASSERT_EQUALS(elements.getSize(), 5U);
+	TEST_ASSERT_EQUALS(elements[0].value, 1);
+	for (std::size_t ii = 1; ii < 5; ++ii) {
+		TEST_ASSERT_EQUALS(elements[ii].value, 2);
+	}
+	elements.clear();
+	TEST_ASSERT_EQUALS(Element::instances, 0);
+}
+
+void
+SmallVectorTest::testReserve()
+{
+	Vector vector{1, 2};
+
+	vector.reserve(3);
+	TEST_ASSERT_TRUE(isInline(vector));
+
+	vector.reserve(10);
+	TEST_ASSERT_FALSE(isInline(vector));
+	TEST_ASSERT_EQUALS(vector.getCapacity(), 10U);
+	TEST_ASSERT_TRUE((vector == Vector{1, 2}));
+
+	vector.resize(10, 5);
+	TEST_ASSERT_EQUALS(vector.getCapacity(), 10U);
+	TEST_ASSERT_EQUALS(vector[9], 5);
+}
+
+void
+SmallVectorTest::testInsertErase()
+{
+	Vector vector{1, 2, 4};
+
+	vector.insert(vector.begin() + 2, 3);
+	TEST_ASSERT_TRUE((vector == Vector{1, 2, 3, 4}));
+
+	vector.insert(vector.begin(), {-1, 0});
+	TEST_ASSERT_TRUE((vector == Vector{-1, 0, 1, 2, 3, 4}));
+
+	vector.erase(vector.begin(), vector.begin() + 4);
+	TEST_ASSERT_TRUE((vector == Vector{3, 4}));
+}
+
+void
+SmallVectorTest::testCopy()
+{
+	Vector small{1, 2};
+	Vector large{1, 2, 3, 4, 5};
+
+	Vector copy(large);
+	TEST_ASSERT_TRUE(copy == large);
+	TEST_ASSERT_FALSE(copy.data() == large.data());
+
+	copy = small;
+	TEST_ASSERT_TRUE(copy == small);
+
+	Vector other(small);
+	TEST_ASSERT_TRUE(isInline(other));
+	other = large;
+	TEST_ASSERT_TRUE(other == large);
+}
+
+void
+SmallVectorTest::testMove()
+{
+	{
+		modm::small_vector<Element, 2> large{1, 2, 3};
+		const Element* data = large.data();
+
+		// the allocated memory is moved
+		modm::small_vector<Element, 2> moved(std::move(large));
+
+		TEST_ASSERT_TRUE(moved.data() == data);
+		TEST_ASSERT_TRUE(large.isEmpty());
+		TEST_ASSERT_EQUALS(large.getCapacity(), 2U);
+		TEST_ASSERT_EQUALS(Element::instances, 3);
+
+		// the inline elements are moved
+		modm::small_vector<Element, 2> small{4};
+		moved = std::move(small);
+
+		TEST_ASSERT_EQUALS(moved.getSize(), 1U);
+		TEST_ASSERT_EQUALS(moved[0].value, 4);
+		TEST_ASSERT_EQUALS(Element::instances, 1);
+
+		large.emplace_back(5);
+		large.emplace_back(6);
+		large.emplace_back(7);
+		swap(large, moved);
+
+		TEST_ASSERT_EQUALS(large.getSize(), 1U);
+		TEST_ASSERT_EQUALS(large[0].value, 4);
+		TEST_ASSERT_EQUALS(moved.getSize(), 3U);
+		TEST_ASSERT_EQUALS(moved[2].value, 7);
+		TEST_ASSERT_EQUALS(Element::instances, 4);
+	}
+	TEST_ASSERT_EQUALS(Element::instances, 0);
+}
+
+void
+SmallVectorTest::testShrinkToFit()
+{
+	Vector vector{1, 2, 3, 4};
+
+	vector.shrink_to_fit();
+	TEST_ASSERT_FALSE(isInline(vector));
+
+	vector.pop_back();
+	vector.shrink_to_fit();
+	TEST_ASSERT_TRUE(isInline(vector));
+	TEST_ASSERT_EQUALS(vector.getCapacity(), 3U);
+	TEST_ASSERT_TRUE((vector == Vector{1, 2, 3}));
+}
+
+void
+SmallVectorTest::testNonTrivialElements()
+{
+	{
+		modm::small_vector<Element, 2> vector;
+		for (int16_t ii = 0; ii < 5; ++ii) {
+			vector.emplace_back(ii);
+		}
+		TEST_ASSERT_EQUALS(Element::instances, 5);
+
+		vector.emplace(vector.begin(), 10);
+		TEST_ASSERT_EQUALS(Element::instances, 6);
+		TEST_ASSERT_EQUALS(vector[0].value, 10);
+		TEST_ASSERT_EQUALS(vector[1].value, 0);
+		TEST_ASSERT_EQUALS(vector[5].value, 4);
+
+		vector.erase(vector.begin() + 1, vector.end());
+		TEST_ASSERT_EQUALS(Element::instances, 1);
+
+		vector.shrink_to_fit();
+		TEST_ASSERT_EQUALS(Element::instances, 1);
+		TEST_ASSERT_EQUALS(vector[0].value, 10);
+
+		vector.resize(8);
+	}
+	TEST_ASSERT_EQUALS(Element::instances, 0);
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/static_flat_map.hpp>
+
+#include "static_flat_map_test.hpp"
+
+namespace
+{
+	using Map = modm::static_flat_map<uint16_t, int16_t, 5>;
+
+	enum class
+	Command : uint8_t
+	{
+		Ping = 0x01,
+		Status = 0x10,
+		Config = 0x22,
+	};
+
+	constexpr modm::static_flat_map<Command, char, 3> table{
+		{Command::Status, 's'}, {Command::Config, 'c'}, {Command::Ping, 'p'}};
+
+	static_assert(table.getSize() == 3);
+	static_assert(table.find(Command::Config)->second == 'c');
+	static_assert(table.contains(Command::Ping));
+
+	constexpr Map
+	modified()
+	{
+		Map map{{1, 1}, {2, 2}};
+		map[3] = 3;
+		map.erase(1);
+		return map;
+	}
+	static_assert(modified().getSize() == 2);
+	static_assert(not modified().contains(1));
+	static_assert(modified().find(3)->second == 3);
+
+	// All keys have the same home slot
+	struct CollidingHash
+	{
+		constexpr std::size_t
+		operator () (uint16_t) const { return 0; }
+	};
+}
+
+void
+StaticFlatMapTest::testConstexpr()
+{
+	TEST_ASSERT_EQUALS(table.getSize(), 3U);
+	TEST_ASSERT_EQUALS(table.getMaxSize(), 3U);
+
+	TEST_ASSERT_EQUALS(table.find(Command::Status)->second, 's');
+	TEST_ASSERT_EQUALS(table.find(Command::Ping)->second, 'p');
+	TEST_ASSERT_TRUE(table.find(Command(0x02)) == table.end());
+}
+
+void
+StaticFlatMapTest::testInsert()
+{
+	Map map;
+
+	TEST_ASSERT_TRUE(map.isEmpty());
+
+	auto [it, inserted] = map.insert({500, 50});
+	TEST_ASSERT_TRUE(inserted);
+	TEST_ASSERT_EQUALS(it->first, 500);
+	TEST_ASSERT_EQUALS(it->second, 50);
+
+	TEST_ASSERT_TRUE(map.insert({100, 10}).second);
+	TEST_ASSERT_TRUE(map.try_emplace(300, 30).second);
+
+	// the key exists already
+	auto result = map.insert({300, 31});
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_EQUALS(result.first->second, 30);
+
+	result = map.insert_or_assign(300, 32);
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_EQUALS(map.find(300)->second, 32);
+
+	TEST_ASSERT_EQUALS(map.getSize(), 3U);
+	TEST_ASSERT_EQUALS(map.find(100)->second, 10);
+	TEST_ASSERT_EQUALS(map.find(500)->second, 50);
+}
+
+void
+StaticFlatMapTest::testFull()
+{
+	Map map{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+
+	TEST_ASSERT_TRUE(map.isFull());
+
+	auto result = map.insert({6, 6});
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_TRUE(result.first == map.end());
+	TEST_ASSERT_FALSE(map.contains(6));
+
+	// existing keys can still be found and assigned
+	result = map.insert_or_assign(2, 20);
+	TEST_ASSERT_FALSE(result.second);
+	TEST_ASSERT_EQUALS(map[2], 20);
+	TEST_ASSERT_EQUALS(map.getSize(), 5U);
+}
+
+void
+StaticFlatMapTest::testErase()
+{
+	Map map{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+
+	TEST_ASSERT_EQUALS(map.erase(2), 1U);
+	TEST_ASSERT_EQUALS(map.erase(2), 0U);
+	TEST_ASSERT_EQUALS(map.getSize(), 3U);
+	TEST_ASSERT_FALSE(map.contains(2));
+
+	map.erase(map.find(1));
+	TEST_ASSERT_EQUALS(map.getSize(), 2U);
+	TEST_ASSERT_FALSE(map.contains(1));
+	TEST_ASSERT_EQUALS(map[3], 3);
+	TEST_ASSERT_EQUALS(map[4], 4);
+
+	map.clear();
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_TRUE(map.find(3) == map.end());
+	TEST_ASSERT_TRUE(map.begin() == map.end());
+}
+
+void
+StaticFlatMapTest::testAccess()
+{
+	Map map;
+
+	map[7] = 70;
+	map[2] += 5;
+
+	TEST_ASSERT_EQUALS(map.getSize(), 2U);
+	TEST_ASSERT_EQUALS(map[7], 70);
+	TEST_ASSERT_EQUALS(map[2], 5);
+	TEST_ASSERT_EQUALS(map.count(7), 1U);
+	TEST_ASSERT_EQUALS(map.count(8), 0U);
+}
+
+void
+StaticFlatMapTest::testIterator()
+{
+	Map map{{4, 40}, {2, 20}, {3, 30}};
+
+	int16_t sum = 0;
+	uint16_t count = 0;
+	for (auto& [key, value] : map)
+	{
+		TEST_ASSERT_EQUALS(value, key * 10);
+		sum += value;
+		value++;
+		count++;
+	}
+	TEST_ASSERT_EQUALS(count, 3U);
+	TEST_ASSERT_EQUALS(sum, 90);
+	TEST_ASSERT_EQUALS(map[3], 31);
+
+	Map::const_iterator it = map.begin();
+	TEST_ASSERT_TRUE(it != map.cend());
+}
+
+void
+StaticFlatMapTest::testCollisions()
+{
+	modm::static_flat_map<uint16_t, int16_t, 6, CollidingHash> map;
+
+	for (uint16_t key = 0; key < 6; ++key) {
+		TEST_ASSERT_TRUE(map.insert({key, int16_t(key * 10)}).second);
+	}
+	TEST_ASSERT_TRUE(map.isFull());
+
+	// erasing from the middle of the probe sequence moves the following keys
+	TEST_ASSERT_EQUALS(map.erase(2), 1U);
+	TEST_ASSERT_EQUALS(map.erase(0), 1U);
+
+	for (uint16_t key = 0; key < 6; ++key)
+	{
+		if (key == 0 or key == 2) {
+			TEST_ASSERT_FALSE(map.contains(key));
+		} else {
+			TEST_ASSERT_EQUALS(map.find(key)->second, key * 10);
+		}
+	}
+
+	TEST_ASSERT_TRUE(map.insert({2, 21}).second);
+	TEST_ASSERT_EQUALS(map[2], 21);
+	TEST_ASSERT_EQUALS(map.getSize(), 5U);
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/static_vector.hpp>
+
+#include "static_vector_test.hpp"
+
+namespace
+{
+	// Counts the number of alive objects
+	struct Element
+	{
+		static inline int16_t instances = 0;
+
+		Element(int16_t value = 0) :
+			value(value)
+		{
+			instances++;
+		}
+
+		Element(const Element& other) :
+			value(other.value)
+		{
+			instances++;
+		}
+
+		Element(Element&& other) :
+			value(other.value)
+		{
+			other.value = -1;
+			instances++;
+		}
+
+		Element&
+		operator = (const Element& other) = default;
+
+		Element&
+		operator = (Element&& other)
+		{
+			value = other.value;
+			other.value = -1;
+			return *this;
+		}
+
+		~Element()
+		{
+			instances--;
+		}
+
+		int16_t value;
+	};
+
+	using Vector = modm::static_vector<int16_t, 5>;
+}
+
+void
+StaticVectorTest::testConstructor()
+{
+	Vector empty;
+
+	TEST_ASSERT_TRUE(empty.isEmpty());
+	TEST_ASSERT_EQUALS(empty.getSize(), 0U);
+	TEST_ASSERT_EQUALS(empty.getCapacity(), 5U);
+	TEST_ASSERT_EQUALS(empty.getMaxSize(), 5U);
+
+	Vector filled(3, 7);
+
+	TEST_ASSERT_EQUALS(filled.getSize(), 3U);
+	TEST_ASSERT_EQUALS(filled[0], 7);
+	TEST_ASSERT_EQUALS(filled[2], 7);
+
+	Vector list{1, 2, 3, 4};
+
+	TEST_ASSERT_EQUALS(list.size(), 4U);
+	TEST_ASSERT_EQUALS(list.front(), 1);
+	TEST_ASSERT_EQUALS(list.back(), 4);
+
+	const int16_t values[] = {5, 6};
+	Vector range(std::begin(values), std::end(values));
+
+	TEST_ASSERT_EQUALS(range.getSize(), 2U);
+	TEST_ASSERT_EQUALS(range[0], 5);
+	TEST_ASSERT_EQUALS(range[1], 6);
+
+	// no heap memory
+	TEST_ASSERT_TRUE(static_cast<const void*>(list.data()) == static_cast<const void*>(&list));
+}
+
+void
+StaticVectorTest::testAppend()
+{
+	Vector vector;
+
+	TEST_ASSERT_TRUE(vector.append(1));
+	vector.push_back(2);
+	TEST_ASSERT_EQUALS(vector.emplace_back(3), 3);
+
+	TEST_ASSERT_EQUALS(vector.getSize(), 3U);
+	TEST_ASSERT_EQUALS(vector.getFront(), 1);
+	TEST_ASSERT_EQUALS(vector.getBack(), 3);
+
+	vector.removeBack();
+
+	TEST_ASSERT_EQUALS(vector.getSize(), 2U);
+	TEST_ASSERT_EQUALS(vector.getBack(), 2);
+
+	vector.removeAll();
+
+	TEST_ASSERT_TRUE(vector.isEmpty());
+}
+
+void
+StaticVectorTest::testFull()
+{
+	Vector vector{1, 2, 3, 4};
+
+	TEST_ASSERT_FALSE(vector.isFull());
+	TEST_ASSERT_TRUE(vector.append(5));
+	TEST_ASSERT_TRUE(vector.isFull());
+
+	TEST_ASSERT_FALSE(vector.append(6));
+	TEST_ASSERT_EQUALS(vector.getSize(), 5U);
+	TEST_ASSERT_EQUALS(vector.getBack(), 5);
+}
+
+void
+StaticVectorTest::testInsertErase()
+{
+	Vector vector{1, 4};
+
+	Vector::iterator it = vector.insert(vector.begin() + 1, 3);
+	TEST_ASSERT_EQUALS(*it, 3);
+
+	vector.insert(vector.begin() + 1, 2);
+	vector.insert(vector.end(), 5);
+
+	TEST_ASSERT_TRUE((vector == Vector{1, 2, 3, 4, 5}));
+
+	it = vector.erase(vector.begin());
+	TEST_ASSERT_EQUALS(*it, 2);
+
+	it = vector.erase(vector.begin() + 1, vector.begin() + 3);
+	TEST_ASSERT_EQUALS(*it, 5);
+	TEST_ASSERT_TRUE((vector == Vector{2, 5}));
+
+	// the inserted value refers to an element of the vector
+	vector.insert(vector.begin(), 2, vector[1]);
+	TEST_ASSERT_TRUE((vector == Vector{5, 5, 2, 5}));
+
+	vector.insert(vector.begin() + 2, {7});
+	TEST_ASSERT_TRUE((vector == Vector{5, 5, 7, 2, 5}));
+}
+
+void
+StaticVectorTest::testResize()
+{
+	Vector vector{1, 2};
+
+	vector.resize(4, 9);
+	TEST_ASSERT_TRUE((vector == Vector{1, 2, 9, 9}));
+
+	vector.resize(1);
+	TEST_ASSERT_TRUE((vector == Vector{1}));
+
+	vector.resize(2);
+	TEST_ASSERT_TRUE((vector == Vector{1, 0}));
+}
+
+void
+StaticVectorTest::testCopy()
+{
+	Vector vector{1, 2, 3};
+	Vector copy(vector);
+
+	TEST_ASSERT_TRUE(copy == vector);
+
+	copy[0] = 10;
+	TEST_ASSERT_EQUALS(vector[0], 1);
+
+	Vector other{4};
+	other = vector;
+	TEST_ASSERT_TRUE(other == vector);
+
+	other = {5, 6};
+	TEST_ASSERT_TRUE((other == Vector{5, 6}));
+}
+
+void
+StaticVectorTest::testMove()
+{
+	{
+		modm::static_vector<Element, 4> vector{1, 2, 3};
+		TEST_ASSERT_EQUALS(Element::instances, 3);
+
+		modm::static_vector<Element, 4> moved(std::move(vector));
+
+		TEST_ASSERT_TRUE(vector.isEmpty());
+		TEST_ASSERT_EQUALS(moved.getSize(), 3U);
+		TEST_ASSERT_EQUALS(moved[0].value, 1);
+		TEST_ASSERT_EQUALS(moved[2].value, 3);
+		TEST_ASSERT_EQUALS(Element::instances, 3);
+
+		modm::static_vector<Element, 4> other{7};
+		other = std::move(moved);
+
+		TEST_ASSERT_EQUALS(other.getSize(), 3U);
+		TEST_ASSERT_EQUALS(other[1].value, 2);
+		TEST_ASSERT_EQUALS(Element::instances, 3);
+
+		other.swap(vector);
+
+		TEST_ASSERT_TRUE(other.isEmpty());
+		TEST_ASSERT_EQUALS(vector.getSize(), 3U);
+		TEST_ASSERT_EQUALS(vector[0].value, 1);
+	}
+	TEST_ASSERT_EQUALS(Element::instances, 0);
+}
+
+void
+StaticVectorTest::testIterator()
+{
+	Vector vector{1, 2, 3};
+
+	int16_t sum = 0;
+	for (int16_t value : vector) {
+		sum += value;
+	}
+	TEST_ASSERT_EQUALS(sum, 6);
+
+	Vector::const_reverse_iterator it = vector.crbegin();
+	TEST_ASSERT_EQUALS(*it, 3);
+	++it;
+	TEST_ASSERT_EQUALS(*it, 2);
+	TEST_ASSERT_EQUALS(vector.rend() - vector.rbegin(), 3);
+
+	static_assert(std::contiguous_iterator<Vector::iterator>);
+	static_assert(std::random_access_iterator<Vector::const_iterator>);
+}
+
+void
+StaticVectorTest::testNonTrivialElements()
+{
+	{
+		modm::static_vector<Element, 4> vector;
+		vector.emplace_back(1);
+		vector.emplace_back(3);
+		vector.emplace(vector.begin() + 1, 2);
+
+		TEST_ASSERT_EQUALS(Element::instances, 3);
+		TEST_ASSERT_EQUALS(vector[0].value, 1);
+		TEST_ASSERT_EQUALS(vector[1].value, 2);
+		TEST_ASSERT_EQUALS(vector[2].value, 3);
+
+		vector.erase(vector.begin());
+
+		TEST_ASSERT_EQUALS(Element::instances, 2);
+		TEST_ASSERT_EQUALS(vector[0].value, 2);
+		TEST_ASSERT_EQUALS(vector[1].value, 3);
+
+		vector.pop_back();
+		TEST_ASSERT_EQUALS(Element::instances, 1);
+
+		vector.resize(4);
+		TEST_ASSERT_EQUALS(Element::instances, 4);
+
+		vector.clear();
+		TEST_ASSERT_EQUALS(Element::instances, 0);
+
+		vector.resize(2);
+	}
+	TEST_ASSERT_EQUALS(Element::instances, 0);
+}
@@ -100,3 +100,30 @@ BlockAllocatorTest::testAlignment()
 
 	delete[] heap;
 }
+
+void
+BlockAllocatorTest::testLargestAvailableSize()
+{
+	uint8_t *heap = new uint8_t[512];
+
+	modm::BlockAllocator<uint16_t, 8> allocator;
+	allocator.initialize(heap, heap + 512);
+
+	TEST_ASSERT_EQUALS(allocator.getLargestAvailableSize(), 496U);
+
+	void* firstBlock = allocator.allocate(12);
+	void* secondBlock = allocator.allocate(13);
+	allocator.allocate(12);
+
+	TEST_ASSERT_EQUALS(allocator.getSize(firstBlock), 12U);
+	TEST_ASSERT_EQUALS(allocator.getSize(secondBlock), 28U);
+	TEST_ASSERT_EQUALS(allocator.getLargestAvailableSize(), 432U);
+
+	// freeing the second block leaves a hole in front of the remaining area
+	allocator.free(secondBlock);
+
+	TEST_ASSERT_EQUALS(allocator.getAvailableSize(), 464U);
+	TEST_ASSERT_EQUALS(allocator.getLargestAvailableSize(), 432U);
+
+	delete[] heap;
+}
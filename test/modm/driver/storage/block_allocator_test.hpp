@@ -32,6 +32,9 @@ public:
 
 	void
 	testAlignment();
+
+	void
+	testLargestAvailableSize();
 };
 
 #endif	// BLOCK_ALLOCATOR_TEST_HPP
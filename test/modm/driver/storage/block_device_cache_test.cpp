@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_cache_test.hpp"
+
+#include <modm/driver/storage/block_device_cache.hpp>
+#include <modm/driver/storage/block_device_heap.hpp>
+
+namespace
+{
+	/// Heap block device with flash-like erase blocks, which counts the accesses
+	class CountingDevice : public modm::BdHeap<1024>
+	{
+	public:
+		static constexpr bd_size_t BlockSizeErase = 128;
+
+		modm::ResumableResult<bool>
+		read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+		{
+			reads++;
+			return BdHeap::read(buffer, address, size);
+		}
+
+		modm::ResumableResult<bool>
+		erase(bd_address_t address, bd_size_t size)
+		{
+			erases++;
+			return BdHeap::erase(address, size);
+		}
+
+		modm::ResumableResult<bool>
+		write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+		{
+			writes++;
+			return BdHeap::write(buffer, address, size);
+		}
+
+		uint16_t reads = 0;
+		uint16_t erases = 0;
+		uint16_t writes = 0;
+	};
+
+	using Cache = modm::BdCache<CountingDevice, 2>;
+
+	uint8_t
+	pattern(uint16_t address)
+	{
+		return address * 7 + 3;
+	}
+
+	void
+	fill(Cache& cache)
+	{
+		RF_CALL_BLOCKING(cache.initialize());
+		uint8_t buffer[128];
+		for (uint16_t block = 0; block < 1024; block += 128)
+		{
+			for (uint16_t ii = 0; ii < 128; ii++) {
+				buffer[ii] = pattern(block + ii);
+			}
+			RF_CALL_BLOCKING(cache.getBlockDevice().write(buffer, block, 128));
+		}
+		cache.getBlockDevice().reads = 0;
+		cache.getBlockDevice().writes = 0;
+	}
+}
+
+void
+BlockDeviceCacheTest::testReadCaching()
+{
+	Cache cache;
+	fill(cache);
+	CountingDevice& device = cache.getBlockDevice();
+
+	uint8_t buffer[8];
+	for (uint16_t address = 0; address < 128; address += 8)
+	{
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, address, 8)));
+		TEST_ASSERT_EQUALS(buffer[0], pattern(address));
+		TEST_ASSERT_EQUALS(buffer[7], pattern(address + 7));
+	}
+	// the whole line is loaded once
+	TEST_ASSERT_EQUALS(device.reads, 1U);
+
+	// complete lines bypass the cache
+	uint8_t line[128];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(line, 512, 128)));
+	TEST_ASSERT_EQUALS(line[5], pattern(512 + 5));
+	TEST_ASSERT_EQUALS(device.reads, 2U);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 0, 8)));
+	TEST_ASSERT_EQUALS(device.reads, 2U);
+}
+
+void
+BlockDeviceCacheTest::testWriteCoalescing()
+{
+	Cache cache;
+	fill(cache);
+	CountingDevice& device = cache.getBlockDevice();
+
+	// small records are collected in the line
+	const uint8_t record[4] = {0xde, 0xad, 0xbe, 0xef};
+	for (uint16_t address = 256; address < 256 + 128; address += 4) {
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.write(record, address, 4)));
+	}
+	TEST_ASSERT_EQUALS(device.reads, 1U);
+	TEST_ASSERT_EQUALS(device.writes, 0U);
+
+	uint8_t buffer[4];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 300, 4)));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, record, 4);
+
+	// and written back as one erase block
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.flush()));
+	TEST_ASSERT_EQUALS(device.writes, 1U);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 380, 4)));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, record, 4);
+
+	// clean lines are not written again
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.flush()));
+	TEST_ASSERT_EQUALS(device.writes, 1U);
+
+	// complete lines are not loaded before they are overwritten
+	uint8_t line[128]{};
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.write(line, 640, 128)));
+	TEST_ASSERT_EQUALS(device.reads, 2U);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.deinitialize()));
+	TEST_ASSERT_EQUALS(device.writes, 2U);
+}
+
+void
+BlockDeviceCacheTest::testEviction()
+{
+	Cache cache;
+	fill(cache);
+	CountingDevice& device = cache.getBlockDevice();
+
+	const uint8_t value = 0x42;
+	uint8_t buffer;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.write(&value, 0, 1)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(&buffer, 128, 1)));
+	// line 0 is used more recently than line 128
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(&buffer, 1, 1)));
+	TEST_ASSERT_EQUALS(device.reads, 2U);
+
+	// evicts line 128, which is clean
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(&buffer, 256, 1)));
+	TEST_ASSERT_EQUALS(device.reads, 3U);
+	TEST_ASSERT_EQUALS(device.writes, 0U);
+
+	// evicts the modified line 0
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(&buffer, 384, 1)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(&buffer, 512, 1)));
+	TEST_ASSERT_EQUALS(device.writes, 1U);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(&buffer, 0, 1)));
+	TEST_ASSERT_EQUALS(buffer, 0x42);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(&buffer, 1, 1)));
+	TEST_ASSERT_EQUALS(buffer, pattern(1));
+}
+
+void
+BlockDeviceCacheTest::testUnalignedAccess()
+{
+	Cache cache;
+	fill(cache);
+
+	uint8_t data[200];
+	for (uint16_t ii = 0; ii < 200; ii++) {
+		data[ii] = 0xff - ii;
+	}
+	// spans three lines
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.write(data, 100, 200)));
+
+	uint8_t buffer[204];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 98, 204)));
+	TEST_ASSERT_EQUALS(buffer[0], pattern(98));
+	TEST_ASSERT_EQUALS(buffer[1], pattern(99));
+	TEST_ASSERT_EQUALS_ARRAY(buffer + 2, data, 200);
+	TEST_ASSERT_EQUALS(buffer[202], pattern(300));
+	TEST_ASSERT_EQUALS(buffer[203], pattern(301));
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.flush()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.getBlockDevice().read(buffer, 98, 204)));
+	TEST_ASSERT_EQUALS(buffer[1], pattern(99));
+	TEST_ASSERT_EQUALS_ARRAY(buffer + 2, data, 200);
+	TEST_ASSERT_EQUALS(buffer[202], pattern(300));
+}
+
+void
+BlockDeviceCacheTest::testErase()
+{
+	Cache cache;
+	fill(cache);
+	CountingDevice& device = cache.getBlockDevice();
+
+	const uint8_t value = 0x42;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.write(&value, 10, 1)));
+
+	// the erase block must be aligned
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(cache.erase(10, 128)));
+
+	// the modified data of the erased line is discarded
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.erase(0, 128)));
+	TEST_ASSERT_EQUALS(device.erases, 1U);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.flush()));
+	TEST_ASSERT_EQUALS(device.writes, 0U);
+
+	// the heap device does not modify the memory when erasing
+	uint8_t buffer;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(&buffer, 10, 1)));
+	TEST_ASSERT_EQUALS(buffer, pattern(10));
+	TEST_ASSERT_EQUALS(device.reads, 2U);
+}
+
+void
+BlockDeviceCacheTest::testInvalidAccess()
+{
+	Cache cache;
+	fill(cache);
+
+	uint8_t buffer[4];
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(cache.read(buffer, 1022, 4)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(cache.write(buffer, 1024, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(cache.read(buffer, 0, 0)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(cache.read(buffer, 1020, 4)));
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_mmap_test.hpp"
+
+#include <modm/driver/storage/block_device_mmap.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+	/// Temporary file, which is created by the test
+	struct Image
+	{
+		static inline char name[] = "/tmp/modm-bd-mmap-XXXXXX";
+	};
+
+	constexpr std::size_t Size = 10'000;
+
+	using Device = modm::BdMmap<Image, Size>;
+	using SyncDevice = modm::BdMmap<Image, Size, modm::BdMmapSync::Synchronous>;
+
+	uint8_t
+	pattern(std::size_t address)
+	{
+		return address * 7 + 3;
+	}
+
+	// Reads the file without the mapping
+	bool
+	readFile(uint8_t* buffer, off_t offset, std::size_t size)
+	{
+		const int fd = ::open(Image::name, O_RDONLY);
+		const bool success = (fd != -1 and pread(fd, buffer, size, offset) == ssize_t(size));
+		if (fd != -1) { ::close(fd); }
+		return success;
+	}
+}
+
+void
+BlockDeviceMmapTest::setUp()
+{
+	std::copy_n("/tmp/modm-bd-mmap-XXXXXX", sizeof(Image::name), Image::name);
+	const int fd = mkstemp(Image::name);
+	TEST_ASSERT_TRUE(fd != -1);
+	if (fd != -1) { ::close(fd); }
+}
+
+void
+BlockDeviceMmapTest::tearDown()
+{
+	unlink(Image::name);
+}
+
+// ----------------------------------------------------------------------------
+void
+BlockDeviceMmapTest::testNewImage()
+{
+	Device device;
+	TEST_ASSERT_TRUE(device.getData().empty());
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+	TEST_ASSERT_EQUALS(device.getData().size(), Size);
+
+	// a new image is erased
+	uint8_t buffer[Size];
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 0, Size)));
+	for (std::size_t ii = 0; ii < Size; ii++) {
+		TEST_ASSERT_EQUALS(buffer[ii], 0xFF);
+	}
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+	TEST_ASSERT_TRUE(device.getData().empty());
+
+	// also in the file
+	TEST_ASSERT_TRUE(readFile(buffer, 0, Size));
+	TEST_ASSERT_EQUALS(buffer[0], 0xFF);
+	TEST_ASSERT_EQUALS(buffer[Size - 1], 0xFF);
+}
+
+void
+BlockDeviceMmapTest::testRoundTrip()
+{
+	uint8_t data[1'000];
+	for (std::size_t ii = 0; ii < sizeof(data); ii++) {
+		data[ii] = pattern(ii);
+	}
+	uint8_t buffer[1'000];
+	{
+		SyncDevice device;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(data, 4'000, sizeof(data))));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 4'000, sizeof(buffer))));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+
+		// written back right away
+		TEST_ASSERT_TRUE(readFile(buffer, 4'000, sizeof(buffer)));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.erase(4'500, 100)));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 4'000, sizeof(buffer))));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, data, 500);
+		for (std::size_t ii = 500; ii < 600; ii++) {
+			TEST_ASSERT_EQUALS(buffer[ii], 0xFF);
+		}
+		TEST_ASSERT_EQUALS_ARRAY(buffer + 600, data + 600, 400);
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+	}
+
+	// the data persists in the file
+	Device device;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 4'000, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, 500);
+	TEST_ASSERT_EQUALS(buffer[550], 0xFF);
+	TEST_ASSERT_EQUALS_ARRAY(buffer + 600, data + 600, 400);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.write(data, 0, sizeof(data))));
+	TEST_ASSERT_TRUE(device.sync());
+	TEST_ASSERT_TRUE(readFile(buffer, 0, sizeof(buffer)));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, sizeof(data));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+}
+
+void
+BlockDeviceMmapTest::testInvalidAccess()
+{
+	Device device;
+	uint8_t buffer[16]{};
+	// not initialized
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.read(buffer, 0, 16)));
+	TEST_ASSERT_FALSE(device.sync());
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.read(buffer, Size - 8, 16)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.program(buffer, Size, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.erase(0, Size + 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.write(buffer, 0, 0)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, Size - 16, 16)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+
+	// a file of another size is rejected
+	modm::BdMmap<Image, Size + 1> other;
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(other.initialize()));
+	TEST_ASSERT_TRUE(other.getData().empty());
+}
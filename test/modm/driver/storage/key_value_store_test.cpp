@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "key_value_store_test.hpp"
+
+#include <modm/driver/storage/key_value_store.hpp>
+#include <modm/driver/storage/block_device_heap.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+	uint8_t memory[1024];
+
+	/// Heap block device with eight sectors, which survives remounting and
+	/// simulates a power loss after programming `budget` bytes
+	class TestDevice : public modm::BdHeap<1024, true>
+	{
+	public:
+		static constexpr bd_size_t BlockSizeErase = 128;
+
+		modm::ResumableResult<bool>
+		initialize()
+		{
+			return BdHeap::initialize(memory);
+		}
+
+		modm::ResumableResult<bool>
+		erase(bd_address_t address, bd_size_t size)
+		{
+			erases[address / BlockSizeErase]++;
+			// the content of erased memory is undefined
+			std::memset(memory + address, 0x5A, size);
+			return BdHeap::erase(address, size);
+		}
+
+		modm::ResumableResult<bool>
+		program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+		{
+			if (budget < size)
+			{
+				std::memcpy(memory + address, buffer, budget);
+				budget = 0;
+#ifdef MODM_RESUMABLE_IS_FIBER
+				return false;
+#else
+				return {modm::rf::Stop, false};
+#endif
+			}
+			budget -= size;
+			return BdHeap::program(buffer, address, size);
+		}
+
+		static inline uint16_t erases[8];
+		static inline bd_size_t budget;
+	};
+
+	using Store = modm::KeyValueStore<TestDevice, 8>;
+
+	bool
+	write(Store& store, uint16_t key, uint32_t value)
+	{
+		return RF_CALL_BLOCKING(store.write(key, reinterpret_cast<const uint8_t*>(&value), sizeof(value)));
+	}
+
+	uint32_t
+	read(Store& store, uint16_t key)
+	{
+		uint32_t value = 0;
+		RF_CALL_BLOCKING(store.read(key, reinterpret_cast<uint8_t*>(&value), sizeof(value)));
+		return value;
+	}
+}
+
+void
+KeyValueStoreTest::setUp()
+{
+	std::memset(memory, 0, sizeof(memory));
+	std::fill(std::begin(TestDevice::erases), std::end(TestDevice::erases), 0);
+	TestDevice::budget = sizeof(memory) * 1000;
+}
+
+void
+KeyValueStoreTest::testWriteRead()
+{
+	Store store;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+	TEST_ASSERT_EQUALS(store.getCount(), 0u);
+	TEST_ASSERT_FALSE(store.contains(1));
+
+	TEST_ASSERT_TRUE(write(store, 1, 0x11111111));
+	TEST_ASSERT_TRUE(write(store, 2, 0x22222222));
+	TEST_ASSERT_EQUALS(store.getCount(), 2u);
+	TEST_ASSERT_TRUE(store.contains(1));
+	TEST_ASSERT_EQUALS(store.getSize(1), 4u);
+	TEST_ASSERT_EQUALS(read(store, 1), 0x11111111u);
+	TEST_ASSERT_EQUALS(read(store, 2), 0x22222222u);
+
+	TEST_ASSERT_TRUE(write(store, 1, 0x33333333));
+	TEST_ASSERT_EQUALS(store.getCount(), 2u);
+	TEST_ASSERT_EQUALS(read(store, 1), 0x33333333u);
+
+	// values have individual sizes
+	const uint8_t text[] = "calibration";
+	uint8_t buffer[sizeof(text)]{};
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.write(3, text, sizeof(text))));
+	TEST_ASSERT_EQUALS(store.getSize(3), sizeof(text));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(store.read(3, buffer, sizeof(text) - 1)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.read(3, buffer, sizeof(buffer))));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, text, sizeof(text));
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.write(4, nullptr, 0)));
+	TEST_ASSERT_TRUE(store.contains(4));
+	TEST_ASSERT_EQUALS(store.getSize(4), 0u);
+
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(store.read(5, buffer, sizeof(buffer))));
+	TEST_ASSERT_EQUALS(store.getSize(5), 0u);
+}
+
+void
+KeyValueStoreTest::testRemove()
+{
+	Store store;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+	TEST_ASSERT_TRUE(write(store, 1, 0x11111111));
+	TEST_ASSERT_TRUE(write(store, 2, 0x22222222));
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.remove(1)));
+	TEST_ASSERT_FALSE(store.contains(1));
+	TEST_ASSERT_EQUALS(store.getCount(), 1u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.remove(7)));
+	TEST_ASSERT_EQUALS(read(store, 2), 0x22222222u);
+
+	Store remounted;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(remounted.mount()));
+	TEST_ASSERT_FALSE(remounted.contains(1));
+	TEST_ASSERT_EQUALS(remounted.getCount(), 1u);
+	TEST_ASSERT_EQUALS(read(remounted, 2), 0x22222222u);
+
+	TEST_ASSERT_TRUE(write(remounted, 1, 0x44444444));
+	TEST_ASSERT_EQUALS(read(remounted, 1), 0x44444444u);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(remounted.format()));
+	TEST_ASSERT_EQUALS(remounted.getCount(), 0u);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+	TEST_ASSERT_EQUALS(store.getCount(), 0u);
+}
+
+void
+KeyValueStoreTest::testMount()
+{
+	Store store;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+	for (uint16_t key = 0; key < 8; key++) {
+		TEST_ASSERT_TRUE(write(store, key, key * 1000));
+	}
+	TEST_ASSERT_TRUE(write(store, 3, 42));
+
+	Store remounted;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(remounted.mount()));
+	TEST_ASSERT_EQUALS(remounted.getCount(), 8u);
+	for (uint16_t key = 0; key < 8; key++) {
+		TEST_ASSERT_EQUALS(read(remounted, key), (key == 3) ? 42u : key * 1000u);
+	}
+
+	// the log continues after the last record
+	TEST_ASSERT_TRUE(write(remounted, 8 - 1, 7));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+	TEST_ASSERT_EQUALS(read(store, 7), 7u);
+	TEST_ASSERT_EQUALS(read(store, 3), 42u);
+}
+
+void
+KeyValueStoreTest::testCompaction()
+{
+	Store store;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+	TEST_ASSERT_TRUE(write(store, 100, 0xC0FFEE));
+
+	// many more updates than records fit on the device
+	for (uint32_t ii = 0; ii < 500; ii++)
+	{
+		TEST_ASSERT_TRUE(write(store, ii % 3, ii));
+		TEST_ASSERT_EQUALS(read(store, ii % 3), ii);
+	}
+	TEST_ASSERT_EQUALS(store.getCount(), 4u);
+	TEST_ASSERT_EQUALS(read(store, 100), 0xC0FFEEu);
+
+	Store remounted;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(remounted.mount()));
+	TEST_ASSERT_EQUALS(remounted.getCount(), 4u);
+	TEST_ASSERT_EQUALS(read(remounted, 0), 498u);
+	TEST_ASSERT_EQUALS(read(remounted, 1), 499u);
+	TEST_ASSERT_EQUALS(read(remounted, 2), 497u);
+	TEST_ASSERT_EQUALS(read(remounted, 100), 0xC0FFEEu);
+
+	// the sectors are erased in turn
+	const auto [least, most] = std::minmax_element(std::begin(TestDevice::erases), std::end(TestDevice::erases));
+	TEST_ASSERT_TRUE(*least > 5);
+	TEST_ASSERT_TRUE(*most - *least <= 1);
+}
+
+void
+KeyValueStoreTest::testBackgroundCompaction()
+{
+	Store store;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+	uint32_t value = 0;
+	while (not store.isCompactionPending()) {
+		TEST_ASSERT_TRUE(write(store, value % 4, value));
+		value++;
+	}
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.compact()));
+	TEST_ASSERT_FALSE(store.isCompactionPending());
+	for (uint16_t key = 0; key < 4; key++) {
+		TEST_ASSERT_EQUALS(read(store, key), value - 4 + ((key - value) % 4));
+	}
+
+	// the free sector was already erased, writes only program
+	uint16_t erases[8];
+	std::copy(std::begin(TestDevice::erases), std::end(TestDevice::erases), erases);
+	while (not store.isCompactionPending()) {
+		TEST_ASSERT_TRUE(write(store, value % 4, value));
+		value++;
+	}
+	TEST_ASSERT_EQUALS_ARRAY(TestDevice::erases, erases, 8);
+
+	// nothing to do
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.compact()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.compact()));
+
+	Store remounted;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(remounted.mount()));
+	for (uint16_t key = 0; key < 4; key++) {
+		TEST_ASSERT_EQUALS(read(remounted, key), value - 4 + ((key - value) % 4));
+	}
+}
+
+void
+KeyValueStoreTest::testPowerLoss()
+{
+	{
+		Store store;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+		TEST_ASSERT_TRUE(write(store, 1, 0x11111111));
+
+		// the power is lost while programming the header
+		TestDevice::budget = 5;
+		TEST_ASSERT_FALSE(write(store, 1, 0x22222222));
+	}
+	TestDevice::budget = sizeof(memory);
+	{
+		Store store;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+		TEST_ASSERT_EQUALS(read(store, 1), 0x11111111u);
+		TEST_ASSERT_TRUE(write(store, 1, 0x33333333));
+		TEST_ASSERT_TRUE(write(store, 2, 0x44444444));
+	}
+
+	uint8_t value[40];
+	std::fill(std::begin(value), std::end(value), 0xAB);
+	{
+		Store store;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+		TEST_ASSERT_EQUALS(read(store, 1), 0x33333333u);
+		TEST_ASSERT_EQUALS(read(store, 2), 0x44444444u);
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.write(3, value, sizeof(value))));
+
+		// the power is lost after the header is programmed
+		std::fill(std::begin(value), std::end(value), 0xCD);
+		TestDevice::budget = 40;
+		TEST_ASSERT_FALSE(RF_CALL_BLOCKING(store.write(3, value, sizeof(value))));
+	}
+	TestDevice::budget = sizeof(memory);
+	{
+		Store store;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+		uint8_t buffer[sizeof(value)];
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.read(3, buffer, sizeof(buffer))));
+		TEST_ASSERT_EQUALS(buffer[0], 0xAB);
+		TEST_ASSERT_EQUALS(buffer[sizeof(buffer) - 1], 0xAB);
+		TEST_ASSERT_TRUE(write(store, 2, 0x55555555));
+	}
+	{
+		Store store;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+		TEST_ASSERT_EQUALS(store.getCount(), 3u);
+		TEST_ASSERT_EQUALS(read(store, 1), 0x33333333u);
+		TEST_ASSERT_EQUALS(read(store, 2), 0x55555555u);
+	}
+}
+
+void
+KeyValueStoreTest::testFull()
+{
+	Store store;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.mount()));
+
+	TEST_ASSERT_FALSE(write(store, Store::InvalidKey, 0));
+	uint8_t value[Store::MaxValueSize + 1]{};
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(store.write(1, value, sizeof(value))));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.write(1, value, Store::MaxValueSize)));
+
+	// the index is full
+	for (uint16_t key = 2; key <= 8; key++) {
+		TEST_ASSERT_TRUE(write(store, key, key));
+	}
+	TEST_ASSERT_FALSE(write(store, 9, 9));
+	TEST_ASSERT_TRUE(write(store, 8, 80));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(store.remove(2)));
+	TEST_ASSERT_TRUE(write(store, 9, 9));
+
+	// the device is full
+	uint16_t key = 2;
+	for (; key <= 8; key++)
+	{
+		if (not RF_CALL_BLOCKING(store.write(key, value, Store::MaxValueSize))) {
+			break;
+		}
+	}
+	TEST_ASSERT_TRUE(key <= 8);
+
+	Store remounted;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(remounted.mount()));
+	TEST_ASSERT_EQUALS(remounted.getCount(), store.getCount());
+	TEST_ASSERT_EQUALS(remounted.getSize(1), Store::MaxValueSize);
+	TEST_ASSERT_EQUALS(read(remounted, 9), 9u);
+	TEST_ASSERT_EQUALS(remounted.getSize(key), (key == 8) ? 4u : 0u);
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef KEY_VALUE_STORE_TEST_HPP
+#define KEY_VALUE_STORE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class KeyValueStoreTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	testWriteRead();
+
+	void
+	testRemove();
+
+	void
+	testMount();
+
+	void
+	testCompaction();
+
+	void
+	testBackgroundCompaction();
+
+	void
+	testPowerLoss();
+
+	void
+	testFull();
+};
+
+#endif	// KEY_VALUE_STORE_TEST_HPP
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "pool_allocator_test.hpp"
+
+#include <modm/driver/storage/pool_allocator.hpp>
+
+using Allocator = modm::PoolAllocator<3, 16>;
+
+void
+PoolAllocatorTest::testSizeClass()
+{
+	TEST_ASSERT_EQUALS(Allocator::MaximumSize, 64U);
+	TEST_ASSERT_EQUALS(Allocator::memorySize(2), 2U * (16 + 32 + 64));
+
+	TEST_ASSERT_EQUALS(Allocator::sizeClass(0), 0U);
+	TEST_ASSERT_EQUALS(Allocator::sizeClass(1), 0U);
+	TEST_ASSERT_EQUALS(Allocator::sizeClass(16), 0U);
+	TEST_ASSERT_EQUALS(Allocator::sizeClass(17), 1U);
+	TEST_ASSERT_EQUALS(Allocator::sizeClass(32), 1U);
+	TEST_ASSERT_EQUALS(Allocator::sizeClass(33), 2U);
+	TEST_ASSERT_EQUALS(Allocator::sizeClass(64), 2U);
+}
+
+void
+PoolAllocatorTest::testAllocate()
+{
+	alignas(16) uint8_t heap[Allocator::memorySize(2)];
+	Allocator allocator;
+	allocator.initialize(heap, 2);
+
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(0), 2U);
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(1), 2U);
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(2), 2U);
+
+	// blocks are allocated in ascending order
+	TEST_ASSERT_EQUALS(allocator.allocate(12), (void *) heap);
+	TEST_ASSERT_EQUALS(allocator.allocate(16), (void *) (heap + 16));
+	TEST_ASSERT_EQUALS(allocator.allocate(20), (void *) (heap + 32));
+	TEST_ASSERT_EQUALS(allocator.allocate(64), (void *) (heap + 96));
+	TEST_ASSERT_EQUALS(allocator.allocate(65), (void *) 0);
+
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(0), 0U);
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(1), 1U);
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(2), 1U);
+
+	TEST_ASSERT_EQUALS(allocator.getBlockSize(heap + 16), 16U);
+	TEST_ASSERT_EQUALS(allocator.getBlockSize(heap + 32), 32U);
+	TEST_ASSERT_EQUALS(allocator.getBlockSize(heap + 96), 64U);
+}
+
+void
+PoolAllocatorTest::testFree()
+{
+	alignas(16) uint8_t heap[Allocator::memorySize(2)];
+	Allocator allocator;
+	allocator.initialize(heap, 2);
+
+	void *a = allocator.allocate(8);
+	void *b = allocator.allocate(40);
+	TEST_ASSERT_TRUE(allocator.owns(a));
+	TEST_ASSERT_TRUE(allocator.owns(b));
+
+	// pointers outside of the pools are not freed
+	uint8_t other;
+	TEST_ASSERT_FALSE(allocator.owns(&other));
+	TEST_ASSERT_FALSE(allocator.free(&other));
+
+	TEST_ASSERT_TRUE(allocator.free(b));
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(2), 2U);
+	TEST_ASSERT_TRUE(allocator.free(a));
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(0), 2U);
+
+	// the last freed block is reused first
+	TEST_ASSERT_EQUALS(allocator.allocate(1), a);
+	TEST_ASSERT_EQUALS(allocator.allocate(33), b);
+}
+
+void
+PoolAllocatorTest::testExhausted()
+{
+	alignas(16) uint8_t heap[Allocator::memorySize(1)];
+	Allocator allocator;
+	allocator.initialize(heap, 1);
+
+	void *a = allocator.allocate(10);
+	TEST_ASSERT_TRUE(a != nullptr);
+	// a larger size class is not used as fallback
+	TEST_ASSERT_EQUALS(allocator.allocate(10), (void *) 0);
+	TEST_ASSERT_EQUALS(allocator.getFreeBlocks(1), 1U);
+
+	allocator.free(a);
+	TEST_ASSERT_EQUALS(allocator.allocate(10), a);
+}
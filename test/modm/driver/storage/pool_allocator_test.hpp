@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef POOL_ALLOCATOR_TEST_HPP
+#define POOL_ALLOCATOR_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class PoolAllocatorTest : public unittest::TestSuite
+{
+public:
+	void
+	testSizeClass();
+
+	void
+	testAllocate();
+
+	void
+	testFree();
+
+	void
+	testExhausted();
+};
+
+#endif	// POOL_ALLOCATOR_TEST_HPP
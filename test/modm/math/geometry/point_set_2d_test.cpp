@@ -14,6 +14,8 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/math/geometry/point_set_2d.hpp>
+#include <modm/container/static_vector.hpp>
+#include <modm/container/small_vector.hpp>
 
 #include "point_set_2d_test.hpp"
 
@@ -78,3 +80,51 @@ PointSet2DTest::testIterator()
 
 	TEST_ASSERT_EQUALS(count, 3);
 }
+
+void
+PointSet2DTest::testStaticVector()
+{
+	modm::PointSet2D<int16_t, modm::static_vector<modm::Vector2i, 3>> set{
+		modm::Vector2i(10, 20), modm::Vector2i(20, 30) };
+
+	TEST_ASSERT_EQUALS(set.getNumberOfPoints(), 2U);
+
+	set.append(modm::Vector2i(30, 40));
+
+	TEST_ASSERT_EQUALS(set.getNumberOfPoints(), 3U);
+	TEST_ASSERT_EQUALS(set[2], modm::Vector2i(30, 40));
+
+	// the set is full
+	set.append(modm::Vector2i(40, 50));
+
+	TEST_ASSERT_EQUALS(set.getNumberOfPoints(), 3U);
+
+	modm::PointSet2D<int16_t> copy(set);
+
+	TEST_ASSERT_EQUALS(copy.getNumberOfPoints(), 3U);
+	TEST_ASSERT_EQUALS(copy[0], modm::Vector2i(10, 20));
+	TEST_ASSERT_EQUALS(copy[2], modm::Vector2i(30, 40));
+
+	set.removeAll();
+
+	TEST_ASSERT_EQUALS(set.getNumberOfPoints(), 0U);
+}
+
+void
+PointSet2DTest::testSmallVector()
+{
+	modm::PointSet2D<int16_t, modm::small_vector<modm::Vector2i, 2>> set;
+
+	for (int16_t ii = 0; ii < 5; ++ii) {
+		set.append(modm::Vector2i(ii, -ii));
+	}
+
+	TEST_ASSERT_EQUALS(set.getNumberOfPoints(), 5U);
+
+	int16_t count = 0;
+	for (const modm::Vector2i& point : set) {
+		TEST_ASSERT_EQUALS(point, modm::Vector2i(count, -count));
+		count++;
+	}
+	TEST_ASSERT_EQUALS(count, 5);
+}
@@ -29,4 +29,10 @@ public:
 
 	void
 	testIterator();
+
+	void
+	testStaticVector();
+
+	void
+	testSmallVector();
 };
@@ -14,6 +14,7 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/math/geometry/polygon_2d.hpp>
+#include <modm/container/static_vector.hpp>
 
 #include "polygon_2d_test.hpp"
 
@@ -380,3 +381,42 @@ Polygon2DTest::testPointContainedCCW()
 	TEST_ASSERT_FALSE(polygon.isInside(modm::Vector<int16_t, 2>(30, -40)));
 	TEST_ASSERT_FALSE(polygon.isInside(modm::Vector<int16_t, 2>(-1, 0)));
 }
+
+void
+Polygon2DTest::testStaticVector()
+{
+	using Polygon = modm::Polygon2D<int16_t, modm::static_vector<modm::Vector2i, 5>>;
+
+	Polygon polygon(5);
+	polygon << modm::Vector2i(0, 0)
+			<< modm::Vector2i(10, 30)
+			<< modm::Vector2i(50, 30)
+			<< modm::Vector2i(30, 0)
+			<< modm::Vector2i(60, -20);
+
+	Polygon triangle {
+		modm::Vector2i(50, 0), modm::Vector2i(20, -30), modm::Vector2i(60, -20) };
+
+	modm::Polygon2D<int16_t> dynamicTriangle {
+		modm::Vector2i(40, 0), modm::Vector2i(70, 30), modm::Vector2i(80, -10) };
+
+	TEST_ASSERT_TRUE(polygon.intersects(triangle));
+	TEST_ASSERT_FALSE(polygon.intersects(dynamicTriangle));
+	TEST_ASSERT_TRUE(dynamicTriangle.intersects(triangle));
+
+	modm::Circle2D<int16_t> circle(modm::Vector2i(20, 10), 20);
+	TEST_ASSERT_TRUE(circle.intersects(polygon));
+
+	modm::PointSet2D<int16_t, modm::static_vector<modm::Vector2i, 4>> points;
+	modm::LineSegment2D<int16_t> line(modm::Vector2i(50, -40),
+									  modm::Vector2i(30, 40));
+
+	TEST_ASSERT_TRUE(line.getIntersections(polygon, points));
+	TEST_ASSERT_EQUALS(points.getNumberOfPoints(), 4U);
+
+	TEST_ASSERT_EQUALS(points[0], modm::Vector2i(32, 30));
+	TEST_ASSERT_EQUALS(points[3], modm::Vector2i(44, -15));
+
+	TEST_ASSERT_TRUE(triangle.isInside(modm::Vector2i(43, -16)));
+	TEST_ASSERT_FALSE(triangle.isInside(modm::Vector2i(20, 10)));
+}
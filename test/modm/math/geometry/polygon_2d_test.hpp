@@ -47,4 +47,7 @@ public:
 
 	void
 	testPointContainedCCW();
+
+	void
+	testStaticVector();
 };
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "heap_statistics_test.hpp"
+
+#include <modm/platform/heap/heap_statistics.hpp>
+#include <modm/architecture/detect.hpp>
+#include <new>
+
+using modm::HeapOperation;
+
+// Keeps the compiler from removing the allocations
+static void* volatile block;
+
+void
+HeapStatisticsTest::testStatistics()
+{
+	const modm::HeapStatistics before = modm::heap_statistics();
+
+	block = new uint32_t[10];
+	modm::HeapStatistics statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.allocations, before.allocations + 1);
+	TEST_ASSERT_EQUALS(statistics.frees, before.frees);
+	// the usable size may be larger than the requested size
+	TEST_ASSERT_TRUE(statistics.used >= before.used + 40);
+	TEST_ASSERT_TRUE(statistics.peak >= statistics.used);
+
+	delete[] static_cast<uint32_t*>(block);
+	statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.allocations, before.allocations + 1);
+	TEST_ASSERT_EQUALS(statistics.frees, before.frees + 1);
+	TEST_ASSERT_EQUALS(statistics.used, before.used);
+	TEST_ASSERT_EQUALS(statistics.failures, before.failures);
+}
+
+void
+HeapStatisticsTest::testPeak()
+{
+	modm::heap_reset_peak();
+	const modm::HeapStatistics before = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(before.peak, before.used);
+
+	block = new uint8_t[1000];
+	delete[] static_cast<uint8_t*>(block);
+
+	modm::HeapStatistics statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.used, before.used);
+	TEST_ASSERT_TRUE(statistics.peak >= before.used + 1000);
+
+	modm::heap_reset_peak();
+	statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.peak, before.used);
+}
+
+struct alignas(64) Aligned
+{
+	uint8_t data[100];
+};
+
+void
+HeapStatisticsTest::testAligned()
+{
+	const modm::HeapStatistics before = modm::heap_statistics();
+
+	Aligned* aligned = new Aligned;
+	block = aligned;
+#ifdef MODM_OS_HOSTED
+	TEST_ASSERT_EQUALS(reinterpret_cast<uintptr_t>(aligned) % alignof(Aligned), 0u);
+#endif
+	modm::HeapStatistics statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.allocations, before.allocations + 1);
+	TEST_ASSERT_TRUE(statistics.used >= before.used + sizeof(Aligned));
+
+	delete aligned;
+	statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.frees, before.frees + 1);
+	TEST_ASSERT_EQUALS(statistics.used, before.used);
+
+	block = new (std::nothrow) Aligned[3];
+	statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.allocations, before.allocations + 2);
+	TEST_ASSERT_TRUE(statistics.used >= before.used + 3 * sizeof(Aligned));
+
+	delete[] static_cast<Aligned*>(block);
+	statistics = modm::heap_statistics();
+	TEST_ASSERT_EQUALS(statistics.frees, before.frees + 2);
+	TEST_ASSERT_EQUALS(statistics.used, before.used);
+}
+
+void
+HeapStatisticsTest::testFragmentation()
+{
+	modm::HeapStatistics statistics{};
+	TEST_ASSERT_EQUALS(statistics.fragmentation(), 0);
+
+	statistics.free = 1000;
+	statistics.largest_free = 1000;
+	TEST_ASSERT_EQUALS(statistics.fragmentation(), 0);
+
+	statistics.largest_free = 250;
+	TEST_ASSERT_EQUALS(statistics.fragmentation(), 75);
+
+	statistics.largest_free = 0;
+	TEST_ASSERT_EQUALS(statistics.fragmentation(), 100);
+}
+
+void
+HeapStatisticsTest::testTrace()
+{
+	modm::HeapTrace& trace = modm::heap_trace();
+	trace.clear();
+	TEST_ASSERT_EQUALS(trace.size(), 0u);
+
+	block = new uint32_t[4];
+	const void* pointer = block;
+	delete[] static_cast<uint32_t*>(block);
+
+	TEST_ASSERT_EQUALS(trace.size(), 2u);
+	TEST_ASSERT_EQUALS(trace.recorded(), 2u);
+
+	TEST_ASSERT_TRUE(trace[0].operation == HeapOperation::Allocate);
+	TEST_ASSERT_EQUALS(trace[0].pointer, pointer);
+	TEST_ASSERT_TRUE(trace[0].size >= 16u);
+	TEST_ASSERT_TRUE(trace[0].callsite != nullptr);
+
+	TEST_ASSERT_TRUE(trace[1].operation == HeapOperation::Free);
+	TEST_ASSERT_EQUALS(trace[1].pointer, pointer);
+	TEST_ASSERT_EQUALS(trace[1].size, trace[0].size);
+
+	// overwrites the oldest events
+	for (size_t ii = 0; ii < trace.Capacity; ii++)
+	{
+		block = new uint8_t;
+		delete static_cast<uint8_t*>(block);
+	}
+	TEST_ASSERT_EQUALS(trace.size(), trace.Capacity);
+	TEST_ASSERT_EQUALS(trace.recorded(), 2u + 2 * trace.Capacity);
+	TEST_ASSERT_TRUE(trace[0].operation == HeapOperation::Allocate);
+	TEST_ASSERT_TRUE(trace[trace.Capacity - 1].operation == HeapOperation::Free);
+}
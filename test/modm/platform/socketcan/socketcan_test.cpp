@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "socketcan_test.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <modm/debug/logger.hpp>
+
+using namespace std::chrono_literals;
+using modm::platform::SocketCan;
+
+namespace
+{
+	constexpr const char* Interface = "vcan0";
+
+	modm::can::Message
+	message(uint32_t identifier, uint8_t length, bool extended = false)
+	{
+		modm::can::Message message(identifier, length);
+		message.setExtended(extended);
+		for (uint8_t ii = 0; ii < length; ii++) {
+			message.data[ii] = uint8_t(identifier + ii);
+		}
+		return message;
+	}
+
+	// Receives all frames which arrive within a short time
+	std::vector<modm::can::Message>
+	receiveAll(SocketCan& can)
+	{
+		std::vector<modm::can::Message> messages;
+		const auto deadline = std::chrono::steady_clock::now() + 50ms;
+		while (std::chrono::steady_clock::now() < deadline)
+		{
+			modm::can::Message received;
+			if (can.getMessage(received)) {
+				messages.push_back(received);
+			} else {
+				std::this_thread::sleep_for(1ms);
+			}
+		}
+		return messages;
+	}
+}
+
+void
+SocketCanTest::setUp()
+{
+	available = receiver.open(Interface) and sender.open(Interface, SocketCan::TransmitMode::Batched);
+	if (not available) {
+		MODM_LOG_WARNING << "SocketCanTest skipped, '" << Interface << "' is not available" << modm::endl;
+	}
+}
+
+void
+SocketCanTest::tearDown()
+{
+	sender.close();
+	receiver.close();
+}
+
+// ----------------------------------------------------------------------------
+void
+SocketCanTest::testBatchedTransmit()
+{
+	if (not available) { return; }
+
+	// queued until flushed
+	for (uint32_t ii = 0; ii < 10; ii++) {
+		TEST_ASSERT_TRUE(sender.sendMessage(message(0x100 + ii, 8)));
+	}
+	TEST_ASSERT_TRUE(receiveAll(receiver).empty());
+	TEST_ASSERT_TRUE(sender.flush());
+
+	std::vector<modm::can::Message> received = receiveAll(receiver);
+	TEST_ASSERT_EQUALS(received.size(), 10u);
+	for (uint32_t ii = 0; ii < received.size(); ii++) {
+		TEST_ASSERT_TRUE(received[ii] == message(0x100 + ii, 8));
+	}
+
+	// a full queue is sent by itself, the receiver takes several batches
+	constexpr uint32_t count = 2 * SocketCan::BatchSize + 5;
+	for (uint32_t ii = 0; ii < count; ii++) {
+		TEST_ASSERT_TRUE(sender.sendMessage(message(ii, ii % 9, ii % 2)));
+	}
+	TEST_ASSERT_EQUALS(receiveAll(receiver).size(), 2 * SocketCan::BatchSize);
+	TEST_ASSERT_TRUE(sender.flush());
+
+	received = receiveAll(receiver);
+	TEST_ASSERT_EQUALS(received.size(), 5u);
+	for (uint32_t ii = 0; ii < received.size(); ii++) {
+		const uint32_t index = 2 * SocketCan::BatchSize + ii;
+		TEST_ASSERT_TRUE(received[ii] == message(index, index % 9, index % 2));
+	}
+}
+
+void
+SocketCanTest::testImmediateTransmit()
+{
+	if (not available) { return; }
+
+	TEST_ASSERT_TRUE(sender.open(Interface));
+	modm::can::Message remote = message(0x7ff, 0);
+	remote.setRemoteTransmitRequest(true);
+	TEST_ASSERT_TRUE(sender.sendMessage(remote));
+	TEST_ASSERT_TRUE(sender.sendMessage(message(0x1fff'ffff, 3, true)));
+
+	const std::vector<modm::can::Message> received = receiveAll(receiver);
+	TEST_ASSERT_EQUALS(received.size(), 2u);
+	TEST_ASSERT_TRUE(received[0] == remote);
+	TEST_ASSERT_TRUE(received[0].isRemoteTransmitRequest());
+	TEST_ASSERT_FALSE(received[0].isFlexibleData());
+	TEST_ASSERT_TRUE(received[1] == message(0x1fff'ffff, 3, true));
+}
+
+void
+SocketCanTest::testFlexibleData()
+{
+	if (not available) { return; }
+
+	// the frame type follows the flags and not the length
+	modm::can::Message fd = message(0x123, 8);
+	fd.setFlexibleData();
+	modm::can::Message brs = message(0x1234'5678, 4, true);
+	brs.setFlexibleData();
+	brs.flags.brs = true;
+	modm::can::Message classic = message(0x321, 8);
+
+	TEST_ASSERT_TRUE(sender.sendMessage(fd));
+	TEST_ASSERT_TRUE(sender.sendMessage(brs));
+	TEST_ASSERT_TRUE(sender.sendMessage(classic));
+	if constexpr (modm::can::Message::capacity > 8) {
+		TEST_ASSERT_TRUE(sender.sendMessage(message(0x456, modm::can::Message::capacity)));
+	}
+	TEST_ASSERT_TRUE(sender.flush());
+
+	const std::vector<modm::can::Message> received = receiveAll(receiver);
+	TEST_ASSERT_EQUALS(received.size(), modm::can::Message::capacity > 8 ? 4u : 3u);
+	if (received.size() < 3) { return; }
+
+	TEST_ASSERT_TRUE(received[0] == fd);
+	TEST_ASSERT_TRUE(received[0].isFlexibleData());
+	TEST_ASSERT_FALSE(received[0].isBitRateSwitching());
+
+	TEST_ASSERT_TRUE(received[1] == brs);
+	TEST_ASSERT_TRUE(received[1].isFlexibleData());
+	TEST_ASSERT_TRUE(received[1].isBitRateSwitching());
+
+	TEST_ASSERT_TRUE(received[2] == classic);
+	TEST_ASSERT_FALSE(received[2].isFlexibleData());
+
+	if (received.size() == 4)
+	{
+		TEST_ASSERT_TRUE(received[3] == message(0x456, modm::can::Message::capacity));
+		TEST_ASSERT_TRUE(received[3].isFlexibleData());
+	}
+}
+
+void
+SocketCanTest::testFilters()
+{
+	if (not available) { return; }
+
+	const SocketCan::Filter filters[] = {
+		{modm::can::StandardIdentifier{0x100}, modm::can::StandardMask{0x700}},
+		{modm::can::ExtendedIdentifier{0x1234'5678}, modm::can::ExtendedMask{0x1fff'ff00}},
+	};
+	TEST_ASSERT_TRUE(receiver.setFilters(filters));
+
+	const modm::can::Message messages[] = {
+		message(0x123, 1),				// accepted
+		message(0x223, 1),				// rejected by the mask
+		message(0x123, 1, true),		// rejected, not a standard frame
+		message(0x1234'56ab, 1, true),	// accepted
+		message(0x1234'5778, 1, true),	// rejected by the mask
+		message(0x078, 1),				// rejected, not an extended frame
+	};
+	for (const auto& msg : messages) {
+		TEST_ASSERT_TRUE(sender.sendMessage(msg));
+	}
+	TEST_ASSERT_TRUE(sender.flush());
+
+	std::vector<modm::can::Message> received = receiveAll(receiver);
+	TEST_ASSERT_EQUALS(received.size(), 2u);
+	if (received.size() == 2)
+	{
+		TEST_ASSERT_TRUE(received[0] == messages[0]);
+		TEST_ASSERT_TRUE(received[1] == messages[3]);
+	}
+
+	// accepts all frames again
+	TEST_ASSERT_TRUE(receiver.setFilters({}));
+	for (const auto& msg : messages) {
+		TEST_ASSERT_TRUE(sender.sendMessage(msg));
+	}
+	TEST_ASSERT_TRUE(sender.flush());
+	received = receiveAll(receiver);
+	TEST_ASSERT_EQUALS(received.size(), std::size(messages));
+}
+
+void
+SocketCanTest::testTimestamps()
+{
+	if (not available) { return; }
+
+	const auto now = [] {
+		return std::chrono::duration_cast<SocketCan::Timestamp>(
+				std::chrono::system_clock::now().time_since_epoch());
+	};
+
+	const SocketCan::Timestamp before = now();
+	TEST_ASSERT_TRUE(sender.sendMessage(message(0x100, 2)));
+	TEST_ASSERT_TRUE(sender.sendMessage(message(0x101, 2)));
+	TEST_ASSERT_TRUE(sender.flush());
+	const SocketCan::Timestamp after = now();
+
+	modm::can::Message received;
+	SocketCan::Timestamp first{}, second{};
+	const auto deadline = std::chrono::steady_clock::now() + 50ms;
+	while (not receiver.getMessage(received, first) and std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::sleep_for(1ms);
+	}
+	TEST_ASSERT_TRUE(receiver.getMessage(received, second));
+
+	// the frames are taken from one batch, but keep their own timestamps
+	TEST_ASSERT_TRUE(first >= before);
+	TEST_ASSERT_TRUE(first <= second);
+	TEST_ASSERT_TRUE(second <= after);
+}
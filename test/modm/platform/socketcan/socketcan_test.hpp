@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+#include <modm/platform/can/socketcan.hpp>
+
+/// Two sockets on the virtual CAN interface `vcan0` receive the frames of
+/// each other. The tests are skipped if the interface does not exist, it is
+/// created with:
+///
+/// \code
+/// ip link add dev vcan0 type vcan && ip link set up vcan0
+/// \endcode
+///
+/// @ingroup modm_test_test_platform_socketcan
+class SocketCanTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp() override;
+
+	void
+	tearDown() override;
+
+	void
+	testBatchedTransmit();
+
+	void
+	testImmediateTransmit();
+
+	void
+	testFlexibleData();
+
+	void
+	testFilters();
+
+	void
+	testTimestamps();
+
+private:
+	modm::platform::SocketCan sender;
+	modm::platform::SocketCan receiver;
+	bool available{false};
+};
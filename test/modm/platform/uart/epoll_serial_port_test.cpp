@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "epoll_serial_port_test.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+	std::vector<uint8_t>
+	pattern(std::size_t size)
+	{
+		std::vector<uint8_t> data(size);
+		for (std::size_t ii = 0; ii < size; ii++) {
+			data[ii] = uint8_t(ii * 7 + ii / 256);
+		}
+		return data;
+	}
+
+	// Reads everything the port has written so far
+	void
+	drain(int fd, std::vector<uint8_t>& data)
+	{
+		uint8_t buffer[4096];
+		ssize_t size;
+		while ((size = ::read(fd, buffer, sizeof(buffer))) > 0) {
+			data.insert(data.end(), buffer, buffer + size);
+		}
+	}
+}
+
+void
+EpollSerialPortTest::setUp()
+{
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	if (master == -1 or grantpt(master) or unlockpt(master)) {
+		TEST_FAIL("Could not create a pseudo terminal");
+		return;
+	}
+	fcntl(master, F_SETFL, O_NONBLOCK);
+	TEST_ASSERT_TRUE(port.open(ptsname(master), 115'200));
+}
+
+void
+EpollSerialPortTest::tearDown()
+{
+	port.close();
+	if (master != -1) {
+		::close(master);
+		master = -1;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+EpollSerialPortTest::testOpen()
+{
+	TEST_ASSERT_TRUE(port.isOpen());
+	TEST_ASSERT_FALSE(port.hasError());
+
+	modm::platform::EpollSerialPort other;
+	// not a standard baud rate
+	TEST_ASSERT_FALSE(other.open(ptsname(master), 1'234));
+	TEST_ASSERT_FALSE(other.isOpen());
+	// not a serial port
+	TEST_ASSERT_FALSE(other.open("/dev/null", 115'200));
+	TEST_ASSERT_FALSE(other.isOpen());
+	TEST_ASSERT_FALSE(other.open("/dev/does-not-exist", 115'200));
+}
+
+void
+EpollSerialPortTest::testBulkWrite()
+{
+	// more than the transmit buffer and the pseudo terminal can hold
+	const std::vector<uint8_t> data = pattern(100'000);
+	std::vector<uint8_t> received;
+
+	std::span<const uint8_t> remaining(data);
+	const auto deadline = Clock::now() + 5s;
+	while ((not remaining.empty() or port.transmitBufferSize()) and Clock::now() < deadline)
+	{
+		remaining = remaining.subspan(port.write(remaining));
+		port.update();
+		drain(master, received);
+	}
+	port.flush();
+	drain(master, received);
+
+	TEST_ASSERT_TRUE(remaining.empty());
+	TEST_ASSERT_EQUALS(port.transmitBufferSize(), 0u);
+	TEST_ASSERT_EQUALS(received.size(), data.size());
+	TEST_ASSERT_TRUE(received == data);
+
+	// single bytes are buffered until they are flushed
+	port.write('a');
+	port.write('b');
+	port.flush();
+	received.clear();
+	drain(master, received);
+	TEST_ASSERT_EQUALS(received.size(), 2u);
+
+	port.write("modm\n");
+	received.clear();
+	drain(master, received);
+	TEST_ASSERT_EQUALS(received.size(), 5u);
+	TEST_ASSERT_FALSE(port.hasError());
+}
+
+void
+EpollSerialPortTest::testBulkRead()
+{
+	const std::vector<uint8_t> data = pattern(100'000);
+	std::vector<uint8_t> received;
+
+	std::size_t written = 0;
+	const auto deadline = Clock::now() + 5s;
+	while (received.size() < data.size() and Clock::now() < deadline)
+	{
+		if (written < data.size())
+		{
+			const ssize_t size = ::write(master, data.data() + written,
+										 std::min<std::size_t>(3'000, data.size() - written));
+			if (size > 0) { written += size; }
+		}
+		// mix single byte and bulk reads
+		char c;
+		if (port.read(c)) { received.push_back(uint8_t(c)); }
+		uint8_t buffer[777];
+		const std::size_t size = port.read(buffer);
+		received.insert(received.end(), buffer, buffer + size);
+		if (written == data.size()) { port.wait(10ms); }
+	}
+
+	TEST_ASSERT_EQUALS(received.size(), data.size());
+	TEST_ASSERT_TRUE(received == data);
+	TEST_ASSERT_EQUALS(port.receiveBufferSize(), 0u);
+
+	// received data is buffered until it is read or discarded
+	TEST_ASSERT_EQUALS(::write(master, "abc", 3), 3);
+	TEST_ASSERT_TRUE(port.wait(1s));
+	TEST_ASSERT_EQUALS(port.discardReceiveBuffer(), 3u);
+	TEST_ASSERT_EQUALS(port.receiveBufferSize(), 0u);
+	TEST_ASSERT_FALSE(port.hasError());
+}
+
+void
+EpollSerialPortTest::testWaitTimeout()
+{
+	auto start = Clock::now();
+	TEST_ASSERT_FALSE(port.wait(20ms));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 20ms);
+
+	start = Clock::now();
+	TEST_ASSERT_FALSE(port.wait(0ms));
+	TEST_ASSERT_TRUE(Clock::now() - start < 20ms);
+
+	// data received while waiting ends the wait early
+	std::thread other([this] { std::this_thread::sleep_for(10ms); (void) ::write(master, "x", 1); });
+	start = Clock::now();
+	TEST_ASSERT_TRUE(port.wait(-1ms));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 10ms);
+	other.join();
+
+	char c;
+	TEST_ASSERT_TRUE(port.read(c));
+	TEST_ASSERT_EQUALS(c, 'x');
+}
+
+void
+EpollSerialPortTest::testWaitWhileTransmitting()
+{
+	// the pseudo terminal cannot take all data at once
+	const std::vector<uint8_t> data = pattern(30'000);
+	TEST_ASSERT_EQUALS(port.write(data), data.size());
+	TEST_ASSERT_TRUE(port.transmitBufferSize() > 0);
+
+	// the other side reads all data and answers afterwards
+	std::vector<uint8_t> received;
+	std::thread other([&]
+	{
+		const auto deadline = Clock::now() + 5s;
+		while (received.size() < data.size() and Clock::now() < deadline)
+		{
+			drain(master, received);
+			std::this_thread::sleep_for(1ms);
+		}
+		std::this_thread::sleep_for(20ms);
+		(void) ::write(master, "ok", 2);
+	});
+
+	// the transmission wakes up the port, but it keeps waiting for data
+	const auto start = Clock::now();
+	TEST_ASSERT_TRUE(port.wait(5s));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 20ms);
+	other.join();
+
+	TEST_ASSERT_EQUALS(port.transmitBufferSize(), 0u);
+	TEST_ASSERT_TRUE(received == data);
+	uint8_t answer[4];
+	TEST_ASSERT_EQUALS(port.read(answer), 2u);
+
+	// the timeout is kept while transmitting
+	TEST_ASSERT_EQUALS(port.write(data), data.size());
+	std::thread reader([&]
+	{
+		received.clear();
+		const auto deadline = Clock::now() + 5s;
+		while (received.size() < data.size() and Clock::now() < deadline) {
+			drain(master, received);
+		}
+	});
+	const auto begin = Clock::now();
+	TEST_ASSERT_FALSE(port.wait(50ms));
+	TEST_ASSERT_TRUE(Clock::now() - begin >= 50ms);
+	port.flush();
+	reader.join();
+	TEST_ASSERT_TRUE(received == data);
+	TEST_ASSERT_FALSE(port.hasError());
+}
+
+void
+EpollSerialPortTest::testHangup()
+{
+	::close(master);
+	master = -1;
+
+	const auto start = Clock::now();
+	TEST_ASSERT_FALSE(port.wait(1s));
+	TEST_ASSERT_TRUE(Clock::now() - start < 1s);
+	TEST_ASSERT_TRUE(port.hasError());
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+#include <modm/platform/uart/epoll_serial_port.hpp>
+
+/// The port is connected to the master side of a pseudo terminal, which
+/// takes the place of the other end of the serial line.
+/// @ingroup modm_test_test_platform_uart
+class EpollSerialPortTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp() override;
+
+	void
+	tearDown() override;
+
+	void
+	testOpen();
+
+	void
+	testBulkWrite();
+
+	void
+	testBulkRead();
+
+	void
+	testWaitTimeout();
+
+	void
+	testWaitWhileTransmitting();
+
+	void
+	testHangup();
+
+private:
+	modm::platform::EpollSerialPort port;
+	int master{-1};
+};
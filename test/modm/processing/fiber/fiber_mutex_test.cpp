@@ -86,6 +86,83 @@ FiberMutexTest::testMutex()
 	modm::fiber::Scheduler::run();
 }
 
+// =============================== MUTEX FIFO =================================
+void
+FiberMutexTest::testMutexFifo()
+{
+	// testMutex() leaves the mutex locked
+	mtx.unlock();
+	modm::fiber::Task fiber1(stack1, []
+	{
+		TEST_ASSERT_EQUALS(state++, 0u);
+		mtx.lock();
+		modm::this_fiber::yield(); // goto 1
+
+		TEST_ASSERT_EQUALS(state++, 3u);
+		// lock is handed over to fiber2
+		mtx.unlock();
+		TEST_ASSERT_FALSE(mtx.try_lock());
+		// queued behind fiber3
+		mtx.lock(); // goto 4
+
+		TEST_ASSERT_EQUALS(state++, 6u);
+		mtx.unlock();
+	});
+	modm::fiber::Task fiber2(stack2, []
+	{
+		TEST_ASSERT_EQUALS(state++, 1u);
+		mtx.lock(); // goto 2
+
+		TEST_ASSERT_EQUALS(state++, 4u);
+		mtx.unlock();
+	});
+	modm::fiber::Task fiber3(stack3, []
+	{
+		TEST_ASSERT_EQUALS(state++, 2u);
+		mtx.lock(); // goto 3
+
+		TEST_ASSERT_EQUALS(state++, 5u);
+		mtx.unlock();
+	});
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(state, 7u);
+	TEST_ASSERT_TRUE(mtx.try_lock());
+	mtx.unlock();
+}
+
+static uint16_t counter;
+static void
+f_count()
+{
+	for (uint8_t ii = 0; ii < 100; ii++)
+	{
+		mtx.lock();
+		const uint16_t value = counter;
+		// all other fibers must block on the mutex
+		modm::this_fiber::yield();
+		counter = value + 1;
+		mtx.unlock();
+		modm::this_fiber::yield();
+	}
+}
+
+void
+FiberMutexTest::testMutexContention()
+{
+	// three fibers contend for the mutex on one thread, see FiberThreadsTest
+	// for fibers running on multiple threads
+	counter = 0;
+	modm::fiber::Task fiber1(stack1, f_count);
+	modm::fiber::Task fiber2(stack2, f_count);
+	modm::fiber::Task fiber3(stack3, f_count);
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(counter, 300u);
+	TEST_ASSERT_TRUE(mtx.try_lock());
+	mtx.unlock();
+}
+
 // ============================== RECURSIVE MUTEX =============================
 static modm::fiber::recursive_mutex rc_mtx;
 
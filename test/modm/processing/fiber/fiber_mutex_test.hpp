@@ -23,6 +23,12 @@ public:
 	void
 	testMutex();
 
+	void
+	testMutexFifo();
+
+	void
+	testMutexContention();
+
 	void
 	testRecursiveMutex();
 
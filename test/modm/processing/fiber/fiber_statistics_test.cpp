@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "fiber_statistics_test.hpp"
+#include "shared.hpp"
+
+#include <modm-test/mock/clock.hpp>
+
+using test_clock_us = modm_test::chrono::micro_clock;
+using modm::fiber::TraceReason;
+
+void
+FiberStatisticsTest::setUp()
+{
+	state = 0;
+	test_clock_us::setTime(1000);
+	modm::fiber::Scheduler::clear_trace();
+}
+
+// Both fibers run twice, fiber1 for 10us and 5us, fiber2 for 20us and 0us.
+static void
+f1()
+{
+	test_clock_us::increment(10);
+	modm::this_fiber::yield();
+	test_clock_us::increment(5);
+}
+
+static void
+f2()
+{
+	test_clock_us::increment(20);
+	modm::this_fiber::yield();
+}
+
+void
+FiberStatisticsTest::testStatistics()
+{
+	modm::fiber::Task fiber1(stack1, f1), fiber2(stack2, f2);
+	TEST_ASSERT_EQUALS(fiber1.statistics().switches, 0u);
+	TEST_ASSERT_EQUALS(fiber1.statistics().runtime, 0u);
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(fiber1.statistics().switches, 2u);
+	TEST_ASSERT_EQUALS(fiber1.statistics().runtime, 15u);
+	TEST_ASSERT_EQUALS(fiber1.statistics().slice_max, 10u);
+
+	TEST_ASSERT_EQUALS(fiber2.statistics().switches, 2u);
+	TEST_ASSERT_EQUALS(fiber2.statistics().runtime, 20u);
+	TEST_ASSERT_EQUALS(fiber2.statistics().slice_max, 20u);
+}
+
+void
+FiberStatisticsTest::testTrace()
+{
+	const auto& trace = modm::fiber::Scheduler::trace();
+	TEST_ASSERT_EQUALS(trace.size(), 0u);
+
+	modm::fiber::Task fiber1(stack1, f1), fiber2(stack2, f2);
+	modm::fiber::Scheduler::run();
+
+	TEST_ASSERT_EQUALS(trace.size(), 5u);
+	TEST_ASSERT_EQUALS(trace.recorded(), 5u);
+
+	TEST_ASSERT_EQUALS(trace[0].timestamp, 1000u);
+	TEST_ASSERT_TRUE(trace[0].from == nullptr);
+	TEST_ASSERT_EQUALS(trace[0].to, &fiber1);
+	TEST_ASSERT_TRUE(trace[0].reason == TraceReason::Start);
+
+	TEST_ASSERT_EQUALS(trace[1].timestamp, 1010u);
+	TEST_ASSERT_EQUALS(trace[1].from, &fiber1);
+	TEST_ASSERT_EQUALS(trace[1].to, &fiber2);
+	TEST_ASSERT_TRUE(trace[1].reason == TraceReason::Yield);
+
+	TEST_ASSERT_EQUALS(trace[2].timestamp, 1030u);
+	TEST_ASSERT_EQUALS(trace[2].from, &fiber2);
+	TEST_ASSERT_EQUALS(trace[2].to, &fiber1);
+	TEST_ASSERT_TRUE(trace[2].reason == TraceReason::Yield);
+
+	TEST_ASSERT_EQUALS(trace[3].timestamp, 1035u);
+	TEST_ASSERT_EQUALS(trace[3].from, &fiber1);
+	TEST_ASSERT_EQUALS(trace[3].to, &fiber2);
+	TEST_ASSERT_TRUE(trace[3].reason == TraceReason::Exit);
+
+	TEST_ASSERT_EQUALS(trace[4].timestamp, 1035u);
+	TEST_ASSERT_EQUALS(trace[4].from, &fiber2);
+	TEST_ASSERT_TRUE(trace[4].to == nullptr);
+	TEST_ASSERT_TRUE(trace[4].reason == TraceReason::Exit);
+}
+
+void
+FiberStatisticsTest::testTraceOverflow()
+{
+	constexpr size_t Capacity = modm::fiber::Trace::Capacity;
+	const auto& trace = modm::fiber::Scheduler::trace();
+
+	modm::fiber::Task fiber1(stack1, []
+	{
+		for (size_t ii = 0; ii < Capacity + 4; ii++)
+		{
+			test_clock_us::increment(1);
+			modm::this_fiber::yield();
+		}
+	});
+	modm::fiber::Scheduler::run();
+
+	// one start, Capacity + 4 yields and one exit
+	TEST_ASSERT_EQUALS(trace.recorded(), Capacity + 6);
+	TEST_ASSERT_EQUALS(trace.size(), Capacity);
+	// the oldest events were overwritten
+	TEST_ASSERT_TRUE(trace[0].reason == TraceReason::Yield);
+	TEST_ASSERT_EQUALS(trace[0].timestamp, 1006u);
+	TEST_ASSERT_EQUALS(trace[0].from, &fiber1);
+	TEST_ASSERT_EQUALS(trace[0].to, &fiber1);
+	TEST_ASSERT_TRUE(trace[Capacity - 1].reason == TraceReason::Exit);
+	TEST_ASSERT_EQUALS(trace[Capacity - 1].timestamp, 1000u + Capacity + 4);
+}
@@ -212,6 +212,16 @@ f7()
 	modm::this_fiber::yield(); // goto 6
 	modm::this_fiber::sleep_until(modm::Clock::now() - 50ms);
 	TEST_ASSERT_EQUALS(state++, 7u);
+
+	// deadlines in the past with the unsigned clock duration only yield
+	const auto deadline = modm::Clock::now();
+	test_clock_ms::increment(10);
+	modm::this_fiber::sleep_until(deadline);
+	TEST_ASSERT_EQUALS(state++, 8u);
+	const auto precise_deadline = modm::PreciseClock::now();
+	test_clock_us::increment(10);
+	modm::this_fiber::sleep_until(precise_deadline);
+	TEST_ASSERT_EQUALS(state++, 9u);
 }
 
 static void
@@ -230,6 +240,122 @@ FiberTest::testSleepUntil()
 	runSleepUntil(0xffff'ffff - 30);
 }
 
+void
+FiberTest::testSleepQueue()
+{
+	test_clock_ms::setTime(0xffff'ffff - 10);
+	test_clock_us::setTime(0xffff'ffff - 10);
+	modm::fiber::Task fiber1(stack1, []
+	{
+		TEST_ASSERT_EQUALS(state++, 0u);
+		modm::this_fiber::sleep_for(20ms); // goto 1
+		// woken after fiber2 due to the later deadline
+		TEST_ASSERT_EQUALS(state++, 6u);
+	});
+	modm::fiber::Task fiber2(stack2, []
+	{
+		TEST_ASSERT_EQUALS(state++, 1u);
+		modm::this_fiber::sleep_for(10ms); // goto 2
+		TEST_ASSERT_EQUALS(state++, 5u);
+		modm::this_fiber::sleep_for(100us); // goto 6
+		TEST_ASSERT_EQUALS(state++, 9u);
+	});
+	modm::fiber::Task fiber3(stack3, []
+	{
+		TEST_ASSERT_EQUALS(state++, 2u);
+		// sleeping fibers are not scheduled
+		modm::this_fiber::yield();
+		TEST_ASSERT_EQUALS(state++, 3u);
+		test_clock_ms::increment(9);
+		modm::this_fiber::yield();
+		TEST_ASSERT_EQUALS(state++, 4u);
+		test_clock_ms::increment(20);
+		modm::this_fiber::yield(); // goto 5
+
+		TEST_ASSERT_EQUALS(state++, 7u);
+		test_clock_us::increment(99);
+		modm::this_fiber::yield();
+		TEST_ASSERT_EQUALS(state++, 8u);
+		test_clock_us::increment(1);
+		modm::this_fiber::yield(); // goto 9
+
+		TEST_ASSERT_EQUALS(state++, 10u);
+	});
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 11u);
+}
+
+static std::chrono::microseconds idle_timeout;
+static void
+idle(std::chrono::microseconds timeout)
+{
+	state++;
+	idle_timeout = timeout;
+	// the mock clocks only advance manually
+	if (timeout >= 1ms) test_clock_ms::increment(std::chrono::ceil<std::chrono::milliseconds>(timeout));
+	else test_clock_us::increment(timeout);
+}
+
+void
+FiberTest::testIdle()
+{
+	test_clock_ms::setTime(0xffff'ffff - 10);
+	test_clock_us::setTime(0xffff'ffff - 10);
+	modm::fiber::Task fiber1(stack1, []
+	{
+		TEST_ASSERT_EQUALS(state++, 0u);
+		modm::this_fiber::sleep_for(20ms); // goto 1
+		TEST_ASSERT_EQUALS(state++, 3u);
+		modm::this_fiber::sleep_for(50us); // goto idle
+		TEST_ASSERT_EQUALS(state++, 5u);
+	});
+	modm::fiber::Task fiber2(stack2, []
+	{
+		TEST_ASSERT_EQUALS(state++, 1u);
+		modm::this_fiber::sleep_for(30ms); // goto idle
+		TEST_ASSERT_EQUALS(state++, 7u);
+	});
+	modm::fiber::Scheduler::run(idle);
+
+	// idle is called at state 2, 4 and 6
+	TEST_ASSERT_EQUALS(state, 8u);
+	TEST_ASSERT_EQUALS(idle_timeout, 10ms);
+}
+
+void
+FiberTest::testPriority()
+{
+	if constexpr (modm::fiber::Scheduler::Priorities < 2) return;
+	test_clock_ms::setTime(0xffff'ffff - 10);
+	// the low priority fiber is added first, but runs last
+	modm::fiber::Task fiber1(stack1, []
+	{
+		TEST_ASSERT_EQUALS(state++, 4u);
+		test_clock_ms::increment(10);
+		modm::this_fiber::yield(); // goto 5
+		TEST_ASSERT_EQUALS(state++, 6u);
+	});
+	modm::fiber::Task fiber2(stack2, []
+	{
+		TEST_ASSERT_EQUALS(state++, 0u);
+		modm::this_fiber::yield(); // goto 1
+		TEST_ASSERT_EQUALS(state++, 2u);
+		modm::this_fiber::sleep_for(10ms); // goto 3
+		// preempts the low priority fiber when woken up
+		TEST_ASSERT_EQUALS(state++, 5u);
+	}, modm::fiber::Start::Now, 1);
+	modm::fiber::Task fiber3(stack3, []
+	{
+		TEST_ASSERT_EQUALS(state++, 1u);
+		modm::this_fiber::yield(); // goto 2
+		TEST_ASSERT_EQUALS(state++, 3u);
+	}, modm::fiber::Start::Now, 1);
+	TEST_ASSERT_EQUALS(fiber1.priority(), 0u);
+	TEST_ASSERT_EQUALS(fiber2.priority(), 1u);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 7u);
+}
+
 static void
 f8(modm::fiber::stop_token stoken)
 {
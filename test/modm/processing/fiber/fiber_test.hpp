@@ -41,6 +41,15 @@ public:
 	void
 	testSleepUntil();
 
+	void
+	testSleepQueue();
+
+	void
+	testIdle();
+
+	void
+	testPriority();
+
 	void
 	testStopToken();
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "fiber_threads_test.hpp"
+#include <modm/processing/fiber.hpp>
+#include <modm/processing/fiber/mutex.hpp>
+#include <modm/processing/fiber/semaphore.hpp>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+
+static constexpr size_t Fibers = 16;
+static modm::fiber::Stack<> stacks[Fibers];
+static std::optional<modm::fiber::Task> tasks[Fibers];
+
+static std::mutex thread_ids_mutex;
+static std::set<std::thread::id> thread_ids;
+
+static void
+record_thread()
+{
+	std::lock_guard _(thread_ids_mutex);
+	thread_ids.insert(std::this_thread::get_id());
+}
+
+template< class Function >
+static void
+run(Function function)
+{
+	thread_ids.clear();
+	for (size_t ii = 0; ii < Fibers; ii++) tasks[ii].emplace(stacks[ii], function);
+	modm::fiber::Scheduler::run();
+	for (auto& task : tasks)
+	{
+		TEST_ASSERT_FALSE(task->isRunning());
+		task.reset();
+	}
+}
+
+// ================================= THREADS ==================================
+void
+FiberThreadsTest::testThreads()
+{
+	static std::atomic<size_t> yields;
+	yields = 0;
+	run([]
+	{
+		for (size_t ii = 0; ii < 1000; ii++)
+		{
+			if (ii % 100 == 0) record_thread();
+			// give the idle threads time to ask for a fiber
+			[[maybe_unused]] volatile size_t work;
+			for (size_t jj = 0; jj < 1000; jj++) work = jj;
+			yields++;
+			modm::this_fiber::yield();
+		}
+	});
+	TEST_ASSERT_EQUALS(yields.load(), Fibers * 1000);
+	// idle threads must have been donated some fibers
+	TEST_ASSERT_TRUE(thread_ids.size() > 1);
+	TEST_ASSERT_TRUE(thread_ids.size() <= modm::fiber::Scheduler::Threads);
+}
+
+// ================================== MUTEX ===================================
+void
+FiberThreadsTest::testMutex()
+{
+	static modm::fiber::mutex mtx;
+	static size_t counter;
+	counter = 0;
+	run([]
+	{
+		for (size_t ii = 0; ii < 200; ii++)
+		{
+			mtx.lock();
+			const size_t value = counter;
+			// all other fibers on all threads must block on the mutex
+			modm::this_fiber::yield();
+			counter = value + 1;
+			mtx.unlock();
+			modm::this_fiber::yield();
+		}
+	});
+	TEST_ASSERT_EQUALS(counter, Fibers * 200);
+	TEST_ASSERT_TRUE(mtx.try_lock());
+	mtx.unlock();
+}
+
+// ================================ SEMAPHORE =================================
+void
+FiberThreadsTest::testSemaphore()
+{
+	static constexpr size_t Items = 500;
+	static modm::fiber::counting_semaphore<Fibers / 2 * Items> items{0};
+	static std::atomic<size_t> consumed, producer;
+	consumed = 0;
+	producer = 0;
+	// half of the fibers produce, the other half block until notified,
+	// possibly by a fiber running on another thread
+	run([]
+	{
+		if (producer++ < Fibers / 2)
+		{
+			for (size_t ii = 0; ii < Items; ii++)
+			{
+				items.release();
+				modm::this_fiber::yield();
+			}
+		}
+		else
+		{
+			for (size_t ii = 0; ii < Items; ii++)
+			{
+				items.acquire();
+				consumed++;
+			}
+		}
+	});
+	TEST_ASSERT_EQUALS(consumed.load(), Fibers / 2 * Items);
+	TEST_ASSERT_FALSE(items.try_acquire());
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "queue_test.hpp"
+
+#include <modm/processing/rtos/queue.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+void
+QueueTest::testAppendGet()
+{
+	modm::rtos::Queue<uint16_t> queue(4);
+	TEST_ASSERT_EQUALS(queue.getSize(), 0u);
+
+	TEST_ASSERT_TRUE(queue.append(1));
+	TEST_ASSERT_TRUE(queue.append(2, 0));
+	TEST_ASSERT_TRUE(queue.appendFromInterrupt(3));
+	TEST_ASSERT_EQUALS(queue.getSize(), 3u);
+
+	uint16_t item = 0;
+	TEST_ASSERT_TRUE(queue.get(item));
+	TEST_ASSERT_EQUALS(item, 1);
+	TEST_ASSERT_TRUE(queue.get(item, 0));
+	TEST_ASSERT_EQUALS(item, 2);
+	TEST_ASSERT_TRUE(queue.getFromInterrupt(item));
+	TEST_ASSERT_EQUALS(item, 3);
+	TEST_ASSERT_EQUALS(queue.getSize(), 0u);
+}
+
+void
+QueueTest::testPrepend()
+{
+	modm::rtos::Queue<uint16_t> queue(4);
+
+	TEST_ASSERT_TRUE(queue.append(1));
+	TEST_ASSERT_TRUE(queue.prepend(2));
+	TEST_ASSERT_TRUE(queue.prependFromInterrupt(3));
+	TEST_ASSERT_TRUE(queue.append(4));
+	TEST_ASSERT_EQUALS(queue.getSize(), 4u);
+
+	// prepended items are removed first, the last one first
+	uint16_t item = 0;
+	for (uint16_t expected : {3, 2, 1, 4})
+	{
+		TEST_ASSERT_TRUE(queue.get(item, 0));
+		TEST_ASSERT_EQUALS(item, expected);
+	}
+	TEST_ASSERT_FALSE(queue.get(item, 0));
+}
+
+void
+QueueTest::testPeek()
+{
+	modm::rtos::Queue<uint16_t> queue(2);
+	uint16_t item = 0;
+	TEST_ASSERT_FALSE(queue.peek(item, 0));
+
+	TEST_ASSERT_TRUE(queue.append(1));
+	TEST_ASSERT_TRUE(queue.peek(item, 0));
+	TEST_ASSERT_EQUALS(item, 1);
+	TEST_ASSERT_EQUALS(queue.getSize(), 1u);
+
+	TEST_ASSERT_TRUE(queue.prepend(2));
+	TEST_ASSERT_TRUE(queue.peek(item, 0));
+	TEST_ASSERT_EQUALS(item, 2);
+	TEST_ASSERT_EQUALS(queue.getSize(), 2u);
+}
+
+void
+QueueTest::testFullEmpty()
+{
+	modm::rtos::Queue<uint16_t> queue(3);
+	uint16_t item = 0;
+	TEST_ASSERT_FALSE(queue.get(item, 0));
+	TEST_ASSERT_FALSE(queue.getFromInterrupt(item));
+
+	// the storage is rounded up to four items, but only three fit
+	TEST_ASSERT_TRUE(queue.append(1, 0));
+	TEST_ASSERT_TRUE(queue.prepend(2, 0));
+	TEST_ASSERT_TRUE(queue.append(3, 0));
+	TEST_ASSERT_FALSE(queue.append(4, 0));
+	TEST_ASSERT_FALSE(queue.prepend(4, 0));
+	TEST_ASSERT_FALSE(queue.appendFromInterrupt(4));
+	TEST_ASSERT_FALSE(queue.prependFromInterrupt(4));
+	TEST_ASSERT_EQUALS(queue.getSize(), 3u);
+
+	TEST_ASSERT_TRUE(queue.get(item, 0));
+	TEST_ASSERT_EQUALS(item, 2);
+	TEST_ASSERT_TRUE(queue.append(4, 0));
+	TEST_ASSERT_FALSE(queue.append(5, 0));
+
+	for (uint16_t expected : {1, 3, 4})
+	{
+		TEST_ASSERT_TRUE(queue.get(item, 0));
+		TEST_ASSERT_EQUALS(item, expected);
+	}
+	TEST_ASSERT_FALSE(queue.get(item, 0));
+	TEST_ASSERT_EQUALS(queue.getSize(), 0u);
+
+	// a queue without space is always full and empty
+	modm::rtos::Queue<uint16_t> none(0);
+	TEST_ASSERT_FALSE(none.append(1, 0));
+	TEST_ASSERT_FALSE(none.prepend(1, 0));
+	TEST_ASSERT_FALSE(none.get(item, 0));
+}
+
+void
+QueueTest::testWrapAround()
+{
+	modm::rtos::Queue<uint32_t> queue(3);
+	uint32_t item = 0;
+	uint32_t next = 0;
+	uint32_t expected = 0;
+	// the positions run through the ring buffer many times
+	for (uint32_t ii = 0; ii < 100; ii++)
+	{
+		while (queue.append(next, 0)) next++;
+		TEST_ASSERT_EQUALS(queue.getSize(), 3u);
+		for (uint32_t jj = 0; jj < (ii % 3) + 1; jj++)
+		{
+			TEST_ASSERT_TRUE(queue.get(item, 0));
+			TEST_ASSERT_EQUALS(item, expected++);
+		}
+		// the nodes of the prepended items are reused as well
+		if (ii % 5 == 0 and queue.prepend(1000 + ii, 0))
+		{
+			TEST_ASSERT_TRUE(queue.get(item, 0));
+			TEST_ASSERT_EQUALS(item, 1000 + ii);
+		}
+	}
+	while (queue.get(item, 0)) TEST_ASSERT_EQUALS(item, expected++);
+	TEST_ASSERT_EQUALS(expected, next);
+}
+
+void
+QueueTest::testTimeout()
+{
+	modm::rtos::Queue<uint16_t> queue(1);
+	uint16_t item = 0;
+
+	auto start = Clock::now();
+	TEST_ASSERT_FALSE(queue.get(item, 20));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 20ms);
+
+	start = Clock::now();
+	TEST_ASSERT_FALSE(queue.peek(item, 20));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 20ms);
+
+	TEST_ASSERT_TRUE(queue.append(1, 20));
+	start = Clock::now();
+	TEST_ASSERT_FALSE(queue.append(2, 20));
+	TEST_ASSERT_FALSE(queue.prepend(2, 20));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 40ms);
+
+	TEST_ASSERT_TRUE(queue.get(item, 20));
+	TEST_ASSERT_EQUALS(item, 1);
+}
+
+void
+QueueTest::testBlocking()
+{
+	modm::rtos::Queue<uint16_t> queue(1);
+	uint16_t item = 0;
+
+	// blocks until an item is appended by another thread
+	std::thread producer([&] { std::this_thread::sleep_for(10ms); queue.append(1); });
+	auto start = Clock::now();
+	TEST_ASSERT_TRUE(queue.get(item));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 10ms);
+	TEST_ASSERT_EQUALS(item, 1);
+	producer.join();
+
+	// blocks until space is made by another thread
+	TEST_ASSERT_TRUE(queue.append(2));
+	uint16_t removed = 0;
+	std::thread consumer([&] { std::this_thread::sleep_for(10ms); queue.get(removed); });
+	start = Clock::now();
+	TEST_ASSERT_TRUE(queue.prepend(3, 1000));
+	TEST_ASSERT_TRUE(Clock::now() - start >= 10ms);
+	consumer.join();
+	TEST_ASSERT_EQUALS(removed, 2);
+
+	TEST_ASSERT_TRUE(queue.peek(item, 1000));
+	TEST_ASSERT_EQUALS(item, 3);
+}
+
+void
+QueueTest::testThreads()
+{
+	static constexpr uint32_t Threads = 4;
+	static constexpr uint32_t Items = 10'000;
+	modm::rtos::Queue<uint32_t> queue(8);
+
+	std::vector<std::thread> producers;
+	for (uint32_t thread = 0; thread < Threads; thread++)
+	{
+		producers.emplace_back([&queue, thread]
+		{
+			for (uint32_t ii = 0; ii < Items; ii++)
+			{
+				const uint32_t item = thread << 16 | ii;
+				if (ii % 7 == 0) queue.prepend(item);
+				else queue.append(item);
+			}
+		});
+	}
+
+	// every item is received exactly once
+	std::vector<std::thread> consumers;
+	std::vector<std::vector<uint32_t>> counts(Threads, std::vector<uint32_t>(Threads * Items));
+	for (uint32_t thread = 0; thread < Threads; thread++)
+	{
+		consumers.emplace_back([&queue, &counts, thread]
+		{
+			uint32_t item;
+			for (uint32_t ii = 0; ii < Items; ii++)
+			{
+				queue.get(item);
+				counts[thread][(item >> 16) * Items + (item & 0xffff)]++;
+			}
+		});
+	}
+	for (auto& producer : producers) producer.join();
+	for (auto& consumer : consumers) consumer.join();
+
+	TEST_ASSERT_EQUALS(queue.getSize(), 0u);
+	uint32_t unique = 0;
+	for (uint32_t index = 0; index < Threads * Items; index++)
+	{
+		uint32_t count = 0;
+		for (const auto& thread : counts) count += thread[index];
+		if (count == 1) unique++;
+	}
+	TEST_ASSERT_EQUALS(unique, Threads * Items);
+}
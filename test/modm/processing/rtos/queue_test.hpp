@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, The modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_processing
+class QueueTest : public unittest::TestSuite
+{
+public:
+	void
+	testAppendGet();
+
+	void
+	testPrepend();
+
+	void
+	testPeek();
+
+	void
+	testFullEmpty();
+
+	void
+	testWrapAround();
+
+	void
+	testTimeout();
+
+	void
+	testBlocking();
+
+	void
+	testThreads();
+};
@@ -25,7 +25,7 @@ class Postman : public xpcc::Postman
 {
 public:
 	xpcc::Postman::DeliverInfo
-	deliverPacket(const xpcc::Header& header, const modm::SmartPointer& payload);
+	deliverPacket(const xpcc::Header& header, const modm::SharedBuffer& payload);
 
 	bool
 	isComponentAvailable(uint8_t component) const;
@@ -62,15 +62,15 @@ private:
 		PayloadBuffer()
 		{}
 
-		PayloadBuffer(const modm::SmartPointer& payload)
+		PayloadBuffer(const modm::SharedBuffer& payload)
 		:	payload(payload) {}
 
 		void
 		remove()
-		{ payload = modm::SmartPointer(); }
+		{ payload = modm::SharedBuffer(); }
 
-		modm::SmartPointer payload;
-	};	// 2B (AVR), 4B (ARM) + 3B HEAP
+		modm::SharedBuffer payload;
+	};	// 2B (AVR), 4B (ARM) + pooled slab
 
 	static constexpr uint8_t resumablePayloads = {{ resumablePayloads }};
 	PayloadBuffer payloadBuffer[resumablePayloads];
@@ -23,7 +23,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <modm/io/iostream.hpp>
-#include <modm/container/smart_pointer.hpp>
+#include <modm/container/shared_buffer.hpp>
 
 namespace {{ namespace }}
 {